@@ -0,0 +1,105 @@
+#include "Bench.hpp"
+
+#include <algorithm>
+#include <format>
+#include <sstream>
+
+
+namespace qjspp::bench {
+
+
+std::vector<BenchFunction>& registry() {
+    static std::vector<BenchFunction> functions;
+    return functions;
+}
+
+
+Runner::Runner(Options options) : options_(std::move(options)) {}
+
+void Runner::run(std::string_view name, std::function<void(uint64_t iterations)> const& fn) {
+    if (!options_.filter.empty() && name.find(options_.filter) == std::string_view::npos) {
+        return;
+    }
+    using Clock = std::chrono::steady_clock;
+
+    // 校准：迭代次数倍增直到单个样本达到最短耗时 (同时作为预热)
+    uint64_t iterations = 1;
+    while (true) {
+        auto begin = Clock::now();
+        fn(iterations);
+        auto elapsed = Clock::now() - begin;
+        if (elapsed >= options_.minSampleTime || iterations >= (uint64_t{1} << 40)) {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    std::vector<double> samples;
+    samples.reserve(options_.samples);
+    for (int i = 0; i < options_.samples; ++i) {
+        auto begin = Clock::now();
+        fn(iterations);
+        auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+        samples.push_back(elapsed / static_cast<double>(iterations));
+    }
+    std::sort(samples.begin(), samples.end());
+
+    Result result{};
+    result.name_       = std::string{name};
+    result.iterations_ = iterations;
+    result.samples_    = static_cast<int>(samples.size());
+    if (!samples.empty()) {
+        result.minNs_    = samples.front();
+        result.medianNs_ = samples[samples.size() / 2];
+        result.maxNs_    = samples.back();
+    }
+    results_.push_back(std::move(result));
+}
+
+std::vector<Result> const& Runner::results() const { return results_; }
+
+std::string Runner::toText() const {
+    std::ostringstream oss;
+    oss << std::format(
+        "{:<44} {:>14} {:>12} {:>12} {:>12}\n",
+        "benchmark",
+        "iterations",
+        "min(ns)",
+        "median(ns)",
+        "max(ns)"
+    );
+    for (auto const& r : results_) {
+        oss << std::format(
+            "{:<44} {:>14} {:>12.2f} {:>12.2f} {:>12.2f}\n",
+            r.name_,
+            r.iterations_,
+            r.minNs_,
+            r.medianNs_,
+            r.maxNs_
+        );
+    }
+    return oss.str();
+}
+
+std::string Runner::toJson() const {
+    // 名称只包含 [a-zA-Z0-9._<>-]，无需转义
+    std::string out = "{\"unit\":\"ns/op\",\"benchmarks\":[";
+    for (size_t i = 0; i < results_.size(); ++i) {
+        auto const& r = results_[i];
+        if (i != 0) out.push_back(',');
+        out += std::format(
+            "{{\"name\":\"{}\",\"iterations\":{},\"samples\":{},\"min\":{:.3f},\"median\":{:.3f},\"max\":{:.3f}}}",
+            r.name_,
+            r.iterations_,
+            r.samples_,
+            r.minNs_,
+            r.medianNs_,
+            r.maxNs_
+        );
+    }
+    out += "]}";
+    return out;
+}
+
+
+} // namespace qjspp::bench
@@ -0,0 +1,73 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace qjspp::bench {
+
+
+struct Result {
+    std::string name_;
+    uint64_t    iterations_{0}; // 单个样本的迭代次数
+    int         samples_{0};    // 样本数
+    double      minNs_{0};      // 每次操作耗时 (ns)
+    double      medianNs_{0};
+    double      maxNs_{0};
+};
+
+class Runner final {
+public:
+    struct Options {
+        int                       samples{7};        // 每个用例的样本数
+        std::chrono::milliseconds minSampleTime{20}; // 单个样本的最短耗时，用于校准迭代次数
+        std::string               filter;            // 名称包含 filter 的用例才会执行
+    };
+
+    explicit Runner(Options options);
+
+    /**
+     * 执行一个用例
+     * @param fn 执行 iterations 次被测操作，循环由用例自身完成 (便于在 JS 侧循环)
+     */
+    void run(std::string_view name, std::function<void(uint64_t iterations)> const& fn);
+
+    [[nodiscard]] std::vector<Result> const& results() const;
+
+    [[nodiscard]] std::string toText() const;
+    [[nodiscard]] std::string toJson() const;
+
+private:
+    Options             options_;
+    std::vector<Result> results_;
+};
+
+
+using BenchFunction = void (*)(Runner& runner);
+
+std::vector<BenchFunction>& registry();
+
+struct Registrar {
+    explicit Registrar(BenchFunction fn) { registry().push_back(fn); }
+};
+
+
+// 阻止编译器优化掉被测表达式的结果
+inline void const volatile* gSink = nullptr;
+
+template <typename T>
+inline void doNotOptimize(T const& value) {
+    gSink = &value;
+}
+
+
+} // namespace qjspp::bench
+
+
+#define QJSPP_BENCH(NAME)                                                                                              \
+    static void                      NAME(::qjspp::bench::Runner& runner);                                             \
+    static ::qjspp::bench::Registrar NAME##Registrar_{&NAME};                                                          \
+    static void                      NAME(::qjspp::bench::Runner& runner)
@@ -0,0 +1,224 @@
+#include "Bench.hpp"
+#include "qjspp/bind/builder/ClassDefineBuilder.hpp"
+#include "qjspp/runtime/JsEngine.hpp"
+#include "qjspp/runtime/Locker.hpp"
+#include "qjspp/types/Function.hpp"
+#include "qjspp/types/Number.hpp"
+#include "qjspp/types/Object.hpp"
+#include "qjspp/types/Value.hpp"
+
+#include <format>
+#include <memory>
+#include <string>
+#include <string_view>
+
+
+namespace {
+
+struct StaticTarget {
+    static void empty() {}
+    static int  add(int a, int b) { return a + b; }
+
+    static int overload(int a) { return a; }
+    static int overload(int a, int b) { return a + b; }
+    static int overload(std::string const& str) { return static_cast<int>(str.size()); }
+
+    static int value;
+};
+int StaticTarget::value = 0;
+
+class Point {
+public:
+    int x{0};
+    int y{0};
+
+    Point() = default;
+    Point(int x, int y) : x(x), y(y) {}
+
+    void noop() {}
+    int  sum() const { return x + y; }
+};
+
+class Segment {
+public:
+    Point const from{1, 2};
+    Point const to{3, 4};
+
+    Segment() = default;
+};
+
+
+qjspp::bind::meta::ClassDefine const StaticDefine =
+    qjspp::bind::defineClass<void>("Static")
+        .function("empty", &StaticTarget::empty)
+        .function("add", &StaticTarget::add)
+        .function(
+            "overload",
+            static_cast<int (*)(int)>(&StaticTarget::overload),
+            static_cast<int (*)(int, int)>(&StaticTarget::overload),
+            static_cast<int (*)(std::string const&)>(&StaticTarget::overload)
+        )
+        .property("value", &StaticTarget::value)
+        .build();
+
+qjspp::bind::meta::ClassDefine const PointDefine = qjspp::bind::defineClass<Point>("Point")
+                                                       .constructor<>()
+                                                       .constructor<int, int>()
+                                                       .instanceProperty("x", &Point::x)
+                                                       .instanceProperty("y", &Point::y)
+                                                       .instanceMethod("noop", &Point::noop)
+                                                       .instanceMethod("sum", &Point::sum)
+                                                       .build();
+
+// 与 PointDefine 相同的成员，以编译期成员表注册
+using PointMembers = qjspp::bind::MemberOf<Point>;
+
+constexpr auto StaticPointMembers = qjspp::bind::defineMembers<Point>(
+    PointMembers::instanceProperty<&Point::x>("x"),
+    PointMembers::instanceProperty<&Point::y>("y"),
+    PointMembers::instanceMethod<&Point::noop>("noop"),
+    PointMembers::instanceMethod<&Point::sum>("sum")
+);
+
+qjspp::bind::meta::ClassDefine const StaticPointDefine =
+    qjspp::bind::defineClass<Point>("StaticPoint").constructor<int, int>().members(StaticPointMembers).build();
+
+qjspp::bind::meta::ClassDefine const SegmentDefine = qjspp::bind::defineClass<Segment>("Segment")
+                                                         .constructor<>()
+                                                         .instancePropertyRef("from", &Segment::from, PointDefine)
+                                                         .instancePropertyRef("to", &Segment::to, PointDefine)
+                                                         .build();
+
+
+// 在 JS 侧循环 n 次执行 body，setup 中声明的变量可在 body 中访问
+void runJs(
+    qjspp::bench::Runner& runner,
+    qjspp::JsEngine&      engine,
+    std::string_view      name,
+    std::string_view      setup,
+    std::string_view      body
+) {
+    auto loop = engine
+                    .eval(std::format(
+                        "(function() {{ {} return function(n) {{ for (let i = 0; i < n; i++) {{ {} }} }}; }})()",
+                        setup,
+                        body
+                    ))
+                    .asFunction();
+    runner.run(name, [&](uint64_t n) { loop.call({}, {qjspp::Number{static_cast<double>(n)}}); });
+}
+
+} // namespace
+
+
+QJSPP_BENCH(BenchStaticBinding) {
+    auto          engine = std::make_unique<qjspp::JsEngine>();
+    qjspp::Locker lock{*engine};
+    engine->registerClass(StaticDefine);
+
+    runJs(runner, *engine, "js.loop.baseline", "", "");
+    runJs(runner, *engine, "static.call.empty", "", "Static.empty();");
+    runJs(runner, *engine, "static.call.add", "", "Static.add(i, 1);");
+    runJs(runner, *engine, "static.property.get", "let v;", "v = Static.value;");
+    runJs(runner, *engine, "static.property.set", "", "Static.value = i;");
+    runJs(runner, *engine, "static.overload.first", "", "Static.overload(i);");
+    runJs(runner, *engine, "static.overload.last", "", "Static.overload('abc');");
+    runJs(runner, *engine, "static.error.count", "", "try { Static.add(i); } catch (e) {}");
+    runJs(runner, *engine, "static.error.type", "", "try { Static.add('a', i); } catch (e) {}");
+    runJs(runner, *engine, "static.error.overload", "", "try { Static.overload(null); } catch (e) {}");
+}
+
+QJSPP_BENCH(BenchInstanceBinding) {
+    auto          engine = std::make_unique<qjspp::JsEngine>();
+    qjspp::Locker lock{*engine};
+    engine->registerClass(PointDefine);
+    engine->registerClass(SegmentDefine);
+
+    runJs(runner, *engine, "instance.method.noop", "const p = new Point(1, 2);", "p.noop();");
+    runJs(runner, *engine, "instance.method.sum", "const p = new Point(1, 2);", "p.sum();");
+    runJs(runner, *engine, "instance.property.get", "const p = new Point(1, 2); let v;", "v = p.x;");
+    runJs(runner, *engine, "instance.property.set", "const p = new Point(1, 2);", "p.x = i;");
+    runJs(runner, *engine, "instance.new.js", "", "new Point(1, 2);");
+    runJs(runner, *engine, "instance.property.ref", "const s = new Segment(); let v;", "v = s.from.x + s.from.y;");
+
+    engine->registerClass(StaticPointDefine);
+    runJs(runner, *engine, "instance.method.sum.static", "const p = new StaticPoint(1, 2);", "p.sum();");
+    runJs(runner, *engine, "instance.property.get.static", "const p = new StaticPoint(1, 2); let v;", "v = p.x;");
+
+    auto shared = std::make_shared<Point>(1, 2);
+    engine->globalThis().set("weak", engine->newInstanceOfWeak(PointDefine, std::weak_ptr<Point>{shared}));
+    runJs(runner, *engine, "instance.method.weak", "", "weak.sum();");
+}
+
+QJSPP_BENCH(BenchNewInstance) {
+    auto          engine = std::make_unique<qjspp::JsEngine>();
+    qjspp::Locker lock{*engine};
+    engine->registerClass(PointDefine);
+
+    Point view{1, 2};
+    auto  shared = std::make_shared<Point>(1, 2);
+
+    runner.run("instance.new.raw", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::bench::doNotOptimize(engine->newInstanceOfRaw(PointDefine, new Point{1, 2}));
+        }
+    });
+    runner.run("instance.new.unique", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::bench::doNotOptimize(engine->newInstanceOfUnique(PointDefine, std::make_unique<Point>(1, 2)));
+        }
+    });
+    runner.run("instance.new.view", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::bench::doNotOptimize(engine->newInstanceOfView(PointDefine, &view));
+        }
+    });
+    runner.run("instance.new.shared", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::bench::doNotOptimize(engine->newInstanceOfShared(PointDefine, std::shared_ptr<Point>{shared}));
+        }
+    });
+    runner.run("instance.new.weak", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::bench::doNotOptimize(engine->newInstanceOfWeak(PointDefine, std::weak_ptr<Point>{shared}));
+        }
+    });
+}
+
+QJSPP_BENCH(BenchRegisterClass) {
+    // 每轮新建引擎并注册三个类，延迟注册只安装全局访问器
+    for (bool lazy : {false, true}) {
+        runner.run(lazy ? "engine.register.lazy" : "engine.register.eager", [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                auto          engine = std::make_unique<qjspp::JsEngine>();
+                qjspp::Locker lock{*engine};
+                engine->registerClass(StaticDefine, lazy);
+                engine->registerClass(PointDefine, lazy);
+                engine->registerClass(SegmentDefine, lazy);
+            }
+        });
+    }
+}
+
+QJSPP_BENCH(BenchDefineClass) {
+    // 类定义的构建开销 (静态初始化期间执行)：逐个成员注册会分配名称与 std::function，成员表只保存引用
+    runner.run("class.define.builder", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::bench::doNotOptimize(qjspp::bind::defineClass<Point>("Point")
+                                            .constructor<int, int>()
+                                            .instanceProperty("x", &Point::x)
+                                            .instanceProperty("y", &Point::y)
+                                            .instanceMethod("noop", &Point::noop)
+                                            .instanceMethod("sum", &Point::sum)
+                                            .build());
+        }
+    });
+    runner.run("class.define.table", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::bench::doNotOptimize(qjspp::bind::defineClass<Point>("StaticPoint")
+                                            .constructor<int, int>()
+                                            .members(StaticPointMembers)
+                                            .build());
+        }
+    });
+}
@@ -0,0 +1,120 @@
+#include "Bench.hpp"
+#include "qjspp/bind/TypeConverter.hpp"
+#include "qjspp/runtime/JsEngine.hpp"
+#include "qjspp/reflection/StructInfo.hpp"
+#include "qjspp/runtime/Locker.hpp"
+#include "qjspp/types/Object.hpp"
+#include "qjspp/types/Value.hpp"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+
+namespace {
+struct BenchEvent {
+    int    id{0};
+    double x{0};
+    double y{0};
+    bool   pressed{false};
+};
+} // namespace
+QJSPP_STRUCT(BenchEvent, id, x, y, pressed);
+
+
+QJSPP_BENCH(BenchTypeConverter) {
+    using qjspp::bind::ConvertToCpp;
+    using qjspp::bind::ConvertToJs;
+    using qjspp::bench::doNotOptimize;
+
+    auto          engine = std::make_unique<qjspp::JsEngine>();
+    qjspp::Locker lock{*engine};
+
+    // number
+    auto jsInt    = ConvertToJs(42);
+    auto jsDouble = ConvertToJs(0.5);
+    runner.run("converter.int.toJs", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToJs(static_cast<int>(i)));
+    });
+    runner.run("converter.int.toCpp", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToCpp<int>(jsInt));
+    });
+    runner.run("converter.uint8.toCpp", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToCpp<uint8_t>(jsInt));
+    });
+    runner.run("converter.double.toCpp", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToCpp<double>(jsDouble));
+    });
+
+    // string
+    std::string str(32, 'x');
+    auto        jsStr = ConvertToJs(str);
+    runner.run("converter.string.toJs", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToJs(str));
+    });
+    runner.run("converter.string.toCpp", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToCpp<std::string>(jsStr));
+    });
+
+    // std::vector<int>
+    std::vector<int> vec(16);
+    for (int i = 0; i < 16; ++i) vec[i] = i;
+    auto jsVec = ConvertToJs(vec);
+    runner.run("converter.vector<int>[16].toJs", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToJs(vec));
+    });
+    runner.run("converter.vector<int>[16].toCpp", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToCpp<std::vector<int>>(jsVec));
+    });
+
+    // std::unordered_map<std::string, int>
+    std::unordered_map<std::string, int> map;
+    for (int i = 0; i < 8; ++i) map.emplace("key" + std::to_string(i), i);
+    auto jsMap = ConvertToJs(map);
+    runner.run("converter.map<string,int>[8].toJs", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToJs(map));
+    });
+    runner.run("converter.map<string,int>[8].toCpp", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToCpp<std::unordered_map<std::string, int>>(jsMap));
+    });
+    runner.run("converter.ordered_map<string,int>[8].toCpp", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToCpp<std::map<std::string, int>>(jsMap));
+    });
+
+    // QJSPP_STRUCT vs 逐个 Object::set
+    BenchEvent event{1, 2.5, 3.5, true};
+    auto       jsEvent = ConvertToJs(event);
+    runner.run("converter.struct[4].toJs", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToJs(event));
+    });
+    runner.run("converter.struct[4].toJs.manual", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            auto obj = qjspp::Object::newObject();
+            obj.set("id", ConvertToJs(event.id));
+            obj.set("x", ConvertToJs(event.x));
+            obj.set("y", ConvertToJs(event.y));
+            obj.set("pressed", ConvertToJs(event.pressed));
+            doNotOptimize(obj);
+        }
+    });
+    runner.run("converter.struct[4].toCpp", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToCpp<BenchEvent>(jsEvent));
+    });
+
+    // std::variant<int, std::string>
+    using Variant = std::variant<int, std::string>;
+    runner.run("converter.variant<int,string>.toJs", [&](uint64_t n) {
+        Variant var{str};
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToJs(var));
+    });
+    runner.run("converter.variant<int,string>.toCpp.first", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToCpp<Variant>(jsInt));
+    });
+    runner.run("converter.variant<int,string>.toCpp.last", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(ConvertToCpp<Variant>(jsStr));
+    });
+}
@@ -0,0 +1,53 @@
+#include "Bench.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+
+// 用法: bench [--json] [--out <file>] [--filter <substr>] [--samples <n>] [--min-time-ms <ms>]
+int main(int argc, char** argv) {
+    qjspp::bench::Runner::Options options{};
+    bool                          json = false;
+    std::string                   out;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg  = argv[i];
+        auto             next = [&]() -> std::string_view {
+            if (i + 1 >= argc) {
+                std::cerr << "missing value for " << arg << std::endl;
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--json") {
+            json = true;
+        } else if (arg == "--out") {
+            out = next();
+        } else if (arg == "--filter") {
+            options.filter = next();
+        } else if (arg == "--samples") {
+            options.samples = std::atoi(next().data());
+        } else if (arg == "--min-time-ms") {
+            options.minSampleTime = std::chrono::milliseconds{std::atoi(next().data())};
+        } else {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            return 2;
+        }
+    }
+
+    qjspp::bench::Runner runner{options};
+    for (auto fn : qjspp::bench::registry()) {
+        fn(runner);
+    }
+
+    auto report = json ? runner.toJson() : runner.toText();
+    if (out.empty()) {
+        std::cout << report << std::endl;
+    } else {
+        std::ofstream{out} << report << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "Bench.hpp"
+#include "qjspp/bind/TypeConverter.hpp"
+#include "qjspp/runtime/JsEngine.hpp"
+#include "qjspp/runtime/Locker.hpp"
+#include "qjspp/types/Arguments.hpp"
+#include "qjspp/types/Function.hpp"
+#include "qjspp/types/JsCallback.hpp"
+#include "qjspp/types/Number.hpp"
+#include "qjspp/types/Object.hpp"
+#include "qjspp/types/String.hpp"
+#include "qjspp/types/Value.hpp"
+
+#include <memory>
+
+
+QJSPP_BENCH(BenchFunctionCall) {
+    using qjspp::bench::doNotOptimize;
+
+    auto          engine = std::make_unique<qjspp::JsEngine>();
+    qjspp::Locker lock{*engine};
+
+    auto empty = engine->eval("(function() {})").asFunction();
+    auto add   = engine->eval("(function(a, b) { return a + b; })").asFunction();
+    auto a     = qjspp::Number{1};
+    auto b     = qjspp::Number{2};
+
+    runner.run("function.call.js.empty", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(empty.call());
+    });
+    runner.run("function.call.js.add", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(add.call({}, {a, b}));
+    });
+    runner.run("function.invoke.js.add", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(add.invoke<int>(1, 2));
+    });
+
+    auto callback = qjspp::JsCallback<int(int, int)>{add};
+    runner.run("callback.js.add", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(callback(1, 2));
+    });
+
+    auto native = qjspp::Function{[](qjspp::Arguments const& args) -> qjspp::Value { return args[0]; }};
+    runner.run("function.call.native", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) doNotOptimize(native.call({}, {a}));
+    });
+}
+
+QJSPP_BENCH(BenchValue) {
+    using qjspp::bench::doNotOptimize;
+
+    auto          engine = std::make_unique<qjspp::JsEngine>();
+    qjspp::Locker lock{*engine};
+
+    qjspp::Value number = qjspp::Number{42};
+    qjspp::Value string = qjspp::String{"value"};
+    qjspp::Value object = qjspp::Object::newObject();
+
+    runner.run("value.copy.number", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::Value copy = number;
+            doNotOptimize(copy);
+        }
+    });
+    runner.run("value.copy.object", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::Value copy = object;
+            doNotOptimize(copy);
+        }
+    });
+    runner.run("value.copy.string", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::Value copy = string;
+            doNotOptimize(copy);
+        }
+    });
+    runner.run("value.assign.object", [&](uint64_t n) {
+        qjspp::Value target;
+        for (uint64_t i = 0; i < n; ++i) {
+            target = (i & 1) ? object : string;
+            doNotOptimize(target);
+        }
+    });
+}
+
+QJSPP_BENCH(BenchLocker) {
+    auto engine = std::make_unique<qjspp::JsEngine>();
+
+    runner.run("locker.acquire", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::Locker lock{*engine};
+        }
+    });
+    runner.run("locker.acquire.nested", [&](uint64_t n) {
+        qjspp::Locker outer{*engine};
+        for (uint64_t i = 0; i < n; ++i) {
+            qjspp::Locker lock{*engine};
+        }
+    });
+}
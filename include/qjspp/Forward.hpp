@@ -9,6 +9,7 @@
 namespace qjspp {
 
 class Value; // base
+class ValueRef;
 class Undefined;
 class Null;
 class Boolean;
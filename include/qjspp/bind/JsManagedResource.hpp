@@ -2,6 +2,8 @@
 #include "qjspp/Global.hpp"
 
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 namespace qjspp {
@@ -9,7 +11,8 @@ namespace qjspp {
 class JsEngine;
 namespace detail {
 struct BindRegistry;
-}
+class FinalizeQueue;
+} // namespace detail
 
 namespace bind {
 namespace meta {
@@ -19,21 +22,46 @@ class ClassDefine;
 struct JsManagedResource final {
     using Accessor  = void* (*)(void* resource); // return instance (T* -> void*)
     using Finalizer = void (*)(void* resource);
+    using Pinner    = std::shared_ptr<void> (*)(void* resource); // 返回实例的强引用 (weak_ptr::lock)
+
+    static constexpr size_t kInlineStorageSize = 4 * sizeof(void*);
+
+    // 资源对实例的所有权，身份缓存命中时据此决定由已有包装对象接管还是拒绝 (BindRegistry::_adoptResource)
+    enum class Ownership : uint8_t {
+        None,      // 视图 / 持有 owner 的视图 / weak_ptr，不持有实例
+        Shared,    // shared_ptr，与其它持有者共享实例
+        Exclusive, // finalizer 直接销毁实例 (Raw / Unique)
+    };
 
 private:
     void*           resource_{nullptr};
     Accessor const  accessor_{nullptr};
     Finalizer const finalizer_{nullptr};
+    Pinner const    pinner_{nullptr};
 
     // internal use only
     meta::ClassDefine const* define_{nullptr};
     JsEngine const*          engine_{nullptr};
     bool const               constructFromJs_{false};
+    void*                    identityKey_{nullptr};       // 身份缓存中的原生指针 (ClassDefine::identityCache_)
+    void*                    pinned_{nullptr};            // Pin 期间固定的实例指针
+    uint32_t                 pinDepth_{0};                // Pin 嵌套深度
+    bool                     engineBound_{false};         // 控制块持有 JavaScript 值，只能在引擎线程析构
+    Ownership                ownership_{Ownership::None}; // make 传入 finalizer 时为 Exclusive，内联控制块默认 None
+    JsManagedResource*       adopted_{nullptr};           // 身份缓存命中时被替换的非持有资源，随本资源一同释放
 
+    // 内联的所有权控制块 (shared_ptr / weak_ptr / 持有 owner 的视图等)，见 makeInline
+    alignas(std::max_align_t) std::byte storage_[kInlineStorageSize];
+
+    friend class qjspp::JsEngine;
     friend detail::BindRegistry;
+    friend detail::FinalizeQueue;
 
 public:
-    [[nodiscard]] inline void* get() const { return resource_ ? accessor_(resource_) : nullptr; }
+    [[nodiscard]] inline void* get() const {
+        if (pinDepth_ != 0) return pinned_;
+        return resource_ ? accessor_(resource_) : nullptr;
+    }
     [[nodiscard]] inline void* operator()() const { return get(); }
 
     inline void finalize() {
@@ -45,18 +73,91 @@ public:
 
     QJSPP_DISABLE_COPY(JsManagedResource);
     explicit JsManagedResource() = delete;
-    explicit JsManagedResource(void* resource, Accessor const accessor, Finalizer const finalizer)
+    explicit JsManagedResource(
+        void*           resource,
+        Accessor const  accessor,
+        Finalizer const finalizer,
+        Pinner const    pinner = nullptr
+    )
     : resource_(resource),
       accessor_(accessor),
-      finalizer_(finalizer) {}
+      finalizer_(finalizer),
+      pinner_(pinner),
+      ownership_(finalizer != nullptr ? Ownership::Exclusive : Ownership::None) {}
 
-    ~JsManagedResource() { finalize(); }
+    ~JsManagedResource() {
+        finalize();
+        delete adopted_;
+    }
+
+    // 持有 Locker 时从当前引擎的资源池分配，否则回退到全局分配器
+    // 注意：由资源池分配的对象需在持有该引擎 Locker 的线程上释放
+    static void* operator new(std::size_t size);
+    static void  operator delete(void* ptr) noexcept;
 
     template <typename... Args>
         requires std::constructible_from<JsManagedResource, Args...>
     static inline std::unique_ptr<JsManagedResource> make(Args&&... args) {
         return std::make_unique<JsManagedResource>(std::forward<Args>(args)...);
     }
+
+    /**
+     * 在资源内部构造控制块 Control，避免为控制块单独分配内存
+     * @param accessor 参数为 Control*，返回实例指针
+     * @note 析构时原地销毁 Control
+     */
+    template <typename Control, typename... Args>
+    static inline std::unique_ptr<JsManagedResource> makeInline(Accessor const accessor, Args&&... args) {
+        return makeInlinePinned<Control>(accessor, nullptr, std::forward<Args>(args)...);
+    }
+
+    /**
+     * 同 makeInline，pinner 用于在原生调用期间固定实例，见 Pin
+     */
+    template <typename Control, typename... Args>
+    static inline std::unique_ptr<JsManagedResource>
+    makeInlinePinned(Accessor const accessor, Pinner const pinner, Args&&... args) {
+        static_assert(sizeof(Control) <= kInlineStorageSize, "Control is too large for inline storage");
+        static_assert(alignof(Control) <= alignof(std::max_align_t), "Control is over-aligned");
+
+        auto managed = make(
+            nullptr,
+            accessor,
+            [](void* res) -> void { std::destroy_at(static_cast<Control*>(res)); },
+            pinner
+        );
+        managed->ownership_ = Ownership::None;
+        managed->resource_ =
+            std::construct_at(reinterpret_cast<Control*>(managed->storage_), std::forward<Args>(args)...);
+        return managed;
+    }
+
+    /**
+     * 在原生调用期间固定实例 (BindRegistry 的方法 / 属性跳板)
+     * @note 存在 pinner 时仅在最外层调用一次 pinner，调用期间 get() 直接返回固定的实例指针
+     * @note 同一对象的嵌套调用共享同一次固定，无 pinner 的资源不做任何处理
+     */
+    class Pin final {
+        JsManagedResource&    res_;
+        std::shared_ptr<void> hold_;
+
+    public:
+        QJSPP_DISABLE_COPY_MOVE(Pin);
+        QJSPP_DISABLE_NEW();
+
+        explicit Pin(JsManagedResource& res) : res_(res) {
+            if (res_.pinner_ == nullptr || res_.pinDepth_ != 0) {
+                if (res_.pinner_ != nullptr) ++res_.pinDepth_;
+                return;
+            }
+            if (res_.resource_ != nullptr) hold_ = res_.pinner_(res_.resource_);
+            res_.pinned_   = hold_.get();
+            res_.pinDepth_ = 1;
+        }
+        ~Pin() {
+            if (res_.pinner_ != nullptr && --res_.pinDepth_ == 0) res_.pinned_ = nullptr;
+        }
+    };
 };
 
 } // namespace bind
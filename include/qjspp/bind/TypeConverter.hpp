@@ -1,7 +1,9 @@
 #pragma once
 #include "qjspp/traits/TypeTraits.hpp"
 #include "qjspp/types/Value.hpp"
+#include "qjspp/types/ValueRef.hpp"
 
+#include <concepts>
 #include <stdexcept>
 #include <string_view>
 #include <type_traits>
@@ -21,6 +23,17 @@ struct TypeConverter {
 template <typename T>
 concept HasTypeConverter = requires { typename TypeConverter<T>; };
 
+/**
+ * 可选的探测接口: static bool canConvert(ValueRef value)
+ * 仅检查值的类型标签 (及少量结构)，不抛出异常；返回 false 时 toCpp 必定失败，返回 true 时 toCpp 通常成功
+ * std::variant / std::optional 与重载分派据此挑选候选，避免以异常驱动的逐个尝试
+ * @note 未提供 canConvert 的转换器 (例如自定义类实例转换器) 视为可能转换，由 toCpp 决定
+ */
+template <typename T>
+concept HasCanConvert = requires(ValueRef value) {
+    { TypeConverter<T>::canConvert(value) } -> std::convertible_to<bool>;
+};
+
 
 namespace internal {
 
@@ -71,6 +84,9 @@ template <typename T>
 template <typename T>
 [[nodiscard]] inline decltype(auto) ConvertToCpp(Value const& value);
 
+template <typename T>
+[[nodiscard]] inline bool CanConvertToCpp(ValueRef value);
+
 } // namespace qjspp::bind
 
 #include "TypeConverter.inl"
@@ -3,7 +3,10 @@
 #include "adapter/CallbackAdapter.hpp"
 #include "qjspp/concepts/BasicConcepts.hpp"
 #include "qjspp/concepts/ScriptConcepts.hpp"
+#include "qjspp/reflection/StructInfo.hpp"
+#include "qjspp/runtime/JsEngine.hpp"
 #include "qjspp/runtime/JsException.hpp"
+#include "qjspp/runtime/Locker.hpp"
 #include "qjspp/types/Array.hpp"
 #include "qjspp/types/BigInt.hpp"
 #include "qjspp/types/Boolean.hpp"
@@ -15,13 +18,28 @@
 #include "qjspp/types/Undefined.hpp"
 #include "qjspp/types/Value.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
 #include <optional>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <variant>
+#include <vector>
 
 namespace qjspp::bind {
 
+namespace adapter {
+template <typename Func>
+FunctionCallback bindStaticFunction(Func&& func);
+} // namespace adapter
+
 // internal type
 template <typename T>
     requires concepts::JsValueType<T>
@@ -54,6 +72,31 @@ struct TypeConverter<T> {
             "Unable to convert Value to T, forgot to add if branch?"
         );
     }
+
+    static bool canConvert(ValueRef value) {
+        if constexpr (std::is_same_v<T, Value>) {
+            return true;
+        } else if constexpr (std::is_same_v<T, Undefined>) {
+            return value->isUndefined();
+        } else if constexpr (std::is_same_v<T, Null>) {
+            return value->isNull();
+        } else if constexpr (std::is_same_v<T, Boolean>) {
+            return value->isBoolean();
+        } else if constexpr (std::is_same_v<T, Number>) {
+            return value->isNumber();
+        } else if constexpr (std::is_same_v<T, BigInt>) {
+            return value->isBigInt();
+        } else if constexpr (std::is_same_v<T, String>) {
+            return value->isString();
+        } else if constexpr (std::is_same_v<T, Object>) {
+            return value->isObject();
+        } else if constexpr (std::is_same_v<T, Array>) {
+            return value->isArray();
+        } else if constexpr (std::is_same_v<T, Function>) {
+            return value->isFunction();
+        }
+        return false;
+    }
 };
 
 // bool <-> Boolean
@@ -62,15 +105,57 @@ struct TypeConverter<bool> {
     static Boolean toJs(bool value) { return Boolean{value}; }
 
     static bool toCpp(Value const& value) { return value.asBoolean().value(); }
+
+    static bool canConvert(ValueRef value) { return value->isBoolean(); }
 };
 
 // int/uint/float/double <-> Number
+// 按标签直接读取 JS_TAG_INT / JS_TAG_FLOAT64，不构造临时 Number，也不调用 QuickJS
+// 整数类型按截断后的值做范围检查，超出范围 (含 NaN / Infinity) 抛出 RangeError
 template <typename T>
     requires(concepts::NumberLike<T> && !std::same_as<T, int64_t> && !std::same_as<T, uint64_t>)
 struct TypeConverter<T> {
     static Number toJs(T value) { return Number::newNumber(value); }
 
-    static T toCpp(Value const& value) { return static_cast<T>(value.asNumber().getDouble()); }
+    static T toCpp(Value const& value) {
+        auto raw = Value::extract(value);
+        auto tag = JS_VALUE_GET_TAG(raw);
+        if constexpr (std::is_integral_v<T>) {
+            if (tag == JS_TAG_INT) [[likely]] {
+                if constexpr (std::is_signed_v<T> && sizeof(T) >= sizeof(int32_t)) {
+                    return static_cast<T>(JS_VALUE_GET_INT(raw));
+                } else {
+                    return narrow(JS_VALUE_GET_INT(raw));
+                }
+            }
+            if (JS_TAG_IS_FLOAT64(tag)) {
+                return narrow(JS_VALUE_GET_FLOAT64(raw));
+            }
+        } else {
+            if (tag == JS_TAG_INT) [[likely]] {
+                return static_cast<T>(JS_VALUE_GET_INT(raw));
+            }
+            if (JS_TAG_IS_FLOAT64(tag)) {
+                return static_cast<T>(JS_VALUE_GET_FLOAT64(raw));
+            }
+        }
+        return static_cast<T>(value.asNumber().getDouble()); // 非 number，抛出类型错误
+    }
+
+    static bool canConvert(ValueRef value) { return value->isNumber(); }
+
+private:
+    static T narrow(double number) {
+        // 上界取 2^digits (double 可精确表示)，避免 max() 转换为 double 时向上舍入
+        constexpr double lower = static_cast<double>(std::numeric_limits<T>::min());
+        constexpr double upper = (static_cast<double>(std::numeric_limits<T>::max() / 2) + 1.0) * 2.0;
+
+        auto truncated = std::trunc(number);
+        if (!(truncated >= lower && truncated < upper)) [[unlikely]] {
+            throw JsException{JsException::Type::RangeError, "number is out of range for the integral type"};
+        }
+        return static_cast<T>(truncated);
+    }
 };
 
 // int64/uint64 <-> BigInt
@@ -86,9 +171,11 @@ struct TypeConverter<T> {
             return value.asBigInt().getUInt64();
         }
     }
+    static bool canConvert(ValueRef value) { return value->isBigInt(); }
 #else
     static Number toJs(T value) { return Number(static_cast<int>(value)); }
     static T      toCpp(Value const& value) { return static_cast<T>(value.asNumber().getInt32()); }
+    static bool   canConvert(ValueRef value) { return value->isNumber(); }
 #endif
 };
 
@@ -99,6 +186,8 @@ struct TypeConverter<T> {
     static String toJs(T const& value) { return String{value}; }
 
     static std::string toCpp(Value const& value) { return value.asString().value(); } // always UTF-8
+
+    static bool canConvert(ValueRef value) { return value->isString(); }
 };
 
 // enum -> Number (enum value)
@@ -108,10 +197,12 @@ struct TypeConverter<T> {
     static Number toJs(T value) { return Number(static_cast<int>(value)); }
 
     static T toCpp(Value const& value) { return static_cast<T>(value.asNumber().getInt32()); }
+
+    static bool canConvert(ValueRef value) { return value->isNumber(); }
 };
 
 
-// std::function -> Function
+// std::function <-> Function
 template <typename R, typename... Args>
 struct TypeConverter<std::function<R(Args...)>> {
     static_assert(
@@ -119,15 +210,44 @@ struct TypeConverter<std::function<R(Args...)>> {
         "Cannot convert std::function to Function; all parameter types must have a TypeConverter"
     );
 
-    // ! UnSupported: cannot convert function to Value
-    static Value toJs(std::function<R(Args...)> const& /* value */) {
-        // TODO: impl
-        throw std::logic_error("UnSupported: cannot convert std::function to Value");
+    // 经 bindStaticFunction 适配后存入 Function 的 opaque 数据，空的 std::function 转换为 null
+    static Value toJs(std::function<R(Args...)> value) {
+        if (!value) {
+            return Null{};
+        }
+        // 由脚本函数转换而来时直接返回原函数，避免再包装一层 (绑定了 receiver 时保留包装，以正确的 this 调用)
+        if (auto cb = value.template target<JsCallback<R(Args...)>>(); cb && cb->isAlive()
+            && cb->engine() == Locker::currentEngine() && cb->receiver().isUndefined()) {
+            return cb->function();
+        }
+        return Function{adapter::bindStaticFunction(std::move(value))};
     }
 
     static std::function<R(Args...)> toCpp(Value const& value) {
         return adapter::bindScriptCallback<R, Args...>(value);
     }
+
+    static bool canConvert(ValueRef value) { return value->isFunction(); }
+};
+
+// JsCallback <-> Function
+template <typename R, typename... Args>
+struct TypeConverter<JsCallback<R(Args...)>> {
+    static_assert(
+        (HasTypeConverter<Args> && ...),
+        "Cannot convert Function to JsCallback; all parameter types must have a TypeConverter"
+    );
+
+    static Value toJs(JsCallback<R(Args...)> const& value) {
+        if (!value.receiver().isUndefined()) {
+            return TypeConverter<std::function<R(Args...)>>::toJs(value); // 包装后以绑定的 receiver 调用
+        }
+        return value.function();
+    }
+
+    static JsCallback<R(Args...)> toCpp(Value const& value) { return adapter::bindScriptCallback<R, Args...>(value); }
+
+    static bool canConvert(ValueRef value) { return value->isFunction(); }
 };
 
 // std::optional <-> null/undefined
@@ -146,6 +266,10 @@ struct TypeConverter<std::optional<T>> {
         }
         return std::optional<T>{ConvertToCpp<T>(value)};
     }
+
+    static bool canConvert(ValueRef value) {
+        return value->isUndefined() || value->isNull() || CanConvertToCpp<T>(value);
+    }
 };
 
 // std::vector <-> Array
@@ -169,15 +293,48 @@ struct TypeConverter<std::vector<T>> {
         }
         return result;
     }
+
+    static bool canConvert(ValueRef value) { return value->isArray(); }
 };
 
-// std::unordered_map <-> Object
-template <typename K, typename V>
-    requires concepts::StringLike<K> // JavaScript only supports string keys
-struct TypeConverter<std::unordered_map<K, V>> {
-    static_assert(HasTypeConverter<V>, "Cannot convert std::unordered_map to Object; type V has no TypeConverter");
+// std::unordered_set <-> Array
+template <typename T>
+struct TypeConverter<std::unordered_set<T>> {
+    static_assert(HasTypeConverter<T>, "Cannot convert std::unordered_set to Array; type T has no TypeConverter");
+
+    static Value toJs(std::unordered_set<T> const& value) {
+        auto        array = Array::newArray(value.size());
+        std::size_t index = 0;
+        for (auto const& item : value) {
+            array.set(index++, ConvertToJs(item));
+        }
+        return array;
+    }
+
+    static std::unordered_set<T> toCpp(Value const& value) {
+        auto array  = value.asArray();
+        auto length = array.length();
 
-    static Value toJs(std::unordered_map<K, V> const& value) {
+        std::unordered_set<T> result;
+        result.reserve(length);
+        for (std::size_t i = 0; i < length; ++i) {
+            result.emplace(ConvertToCpp<T>(array[i]));
+        }
+        return result;
+    }
+
+    static bool canConvert(ValueRef value) { return value->isArray(); }
+};
+
+// std::unordered_map / std::map / flat_map <-> Object
+template <typename T>
+    requires concepts::StringKeyedMap<T> // JavaScript only supports string keys
+struct TypeConverter<T> {
+    using K = typename T::key_type;
+    using V = typename T::mapped_type;
+    static_assert(HasTypeConverter<V>, "Cannot convert map to Object; mapped type has no TypeConverter");
+
+    static Value toJs(T const& value) {
         auto object = Object::newObject();
         for (auto const& [key, val] : value) {
             object.set(key, ConvertToJs(val));
@@ -185,16 +342,110 @@ struct TypeConverter<std::unordered_map<K, V>> {
         return object;
     }
 
-    static std::unordered_map<K, V> toCpp(Value const& value) {
+    // 按 atom 遍历属性，键只构造一次
+    static T toCpp(Value const& value) {
         auto object = value.asObject();
-        auto keys   = object.getOwnPropertyNamesAsString();
 
-        std::unordered_map<K, V> result;
-        for (auto const& key : keys) {
-            result[key] = ConvertToCpp<V>(object.get(key));
+        T result;
+        if constexpr (concepts::SortedVectorMap<T>) {
+            // 属性顺序与键序无关，先排序再依次追加到末尾，避免有序数组逐个插入的搬移
+            std::vector<std::pair<K, V>> entries;
+            object.forEachOwnProperty(
+                [&](std::string_view key, Value const& val) { entries.emplace_back(K(key), ConvertToCpp<V>(val)); },
+                [&](std::size_t count) { entries.reserve(count); }
+            );
+            std::sort(entries.begin(), entries.end(), [comp = result.key_comp()](auto const& lhs, auto const& rhs) {
+                return comp(lhs.first, rhs.first);
+            });
+            if constexpr (concepts::HasReserve<T>) {
+                result.reserve(entries.size());
+            }
+            for (auto& [key, val] : entries) {
+                result.emplace_hint(result.end(), std::move(key), std::move(val));
+            }
+        } else {
+            object.forEachOwnProperty(
+                [&](std::string_view key, Value const& val) { result.emplace(K(key), ConvertToCpp<V>(val)); },
+                [&](std::size_t count) {
+                    if constexpr (concepts::HasReserve<T>) {
+                        result.reserve(count);
+                    }
+                }
+            );
         }
         return result;
     }
+
+    static bool canConvert(ValueRef value) { return value->isObject(); }
+};
+
+// 反射结构体 (QJSPP_STRUCT) <-> Object
+template <typename T>
+    requires reflection::ReflectableStruct<T>
+struct TypeConverter<T> {
+    static constexpr std::size_t N     = reflection::StructFieldCount_v<T>;
+    static constexpr auto        names = reflection::getStructFieldNames<T>();
+
+    // 字段 atom 在每个引擎中只创建一次
+    static JSAtom const* atoms(JsEngine& engine) {
+        static size_t const slot = JsEngine::allocateAtomCacheSlot();
+        return engine.getCachedAtoms(slot, names);
+    }
+
+    static Value toJs(T const& value) {
+        auto& engine = Locker::currentEngineChecked();
+        auto  keys   = atoms(engine);
+
+        // 转换中途抛出异常时释放已转换的字段值
+        struct FieldBuffer {
+            JSValue     values[N]{};
+            std::size_t count{0};
+
+            ~FieldBuffer() {
+                for (std::size_t i = 0; i < count; ++i) {
+                    detail::freeValue(values[i]);
+                }
+            }
+        } buffer;
+        std::apply(
+            [&](auto const&... fields) {
+                ((buffer.values[buffer.count++] = Value::release(ConvertToJs(value.*(fields.member)))), ...);
+            },
+            reflection::StructInfo<T>::fields()
+        );
+
+        // 以固定的属性列表一次性创建对象，字段值所有权转移给 JS_NewObjectFrom (失败时同样由其释放)
+        buffer.count = 0;
+        auto object  = JS_NewObjectFrom(engine.context(), static_cast<int>(N), keys, buffer.values);
+        JsException::check(object);
+        return Value::move<Value>(object);
+    }
+
+    static T toCpp(Value const& value) {
+        if (!value.isObject()) [[unlikely]] {
+            throw JsException{JsException::Type::TypeError, "expected object"};
+        }
+        auto& engine = Locker::currentEngineChecked();
+        auto  keys   = atoms(engine);
+
+        T           result{};
+        std::size_t index = 0;
+        std::apply(
+            [&](auto const&... fields) { (getField(result, fields, engine, value, keys[index++]), ...); },
+            reflection::StructInfo<T>::fields()
+        );
+        return result;
+    }
+
+    static bool canConvert(ValueRef value) { return value->isObject(); }
+
+private:
+    template <typename Field>
+    static void getField(T& result, Field const& field, JsEngine& engine, Value const& object, JSAtom atom) {
+        auto val = JS_GetProperty(engine.context(), Value::extract(object), atom);
+        JsException::check(val);
+        result.*(field.member) = ConvertToCpp<typename Field::MemberType>(Value::move<Value>(val));
+    }
 };
 
 // std::variant <-> Type
@@ -215,6 +466,9 @@ struct TypeConverter<std::variant<Is...>> {
 
     static TypedVariant toCpp(Value const& value) { return tryToCpp(value); }
 
+    static bool canConvert(ValueRef value) { return (CanConvertToCpp<Is>(value) || ...); }
+
+    // 先以 canConvert 跳过类型不符的候选，仅对探测通过的候选尝试转换
     template <size_t I = 0>
     static TypedVariant tryToCpp(Value const& value) {
         if constexpr (I >= sizeof...(Is)) {
@@ -224,6 +478,9 @@ struct TypeConverter<std::variant<Is...>> {
             };
         } else {
             using Type = std::variant_alternative_t<I, TypedVariant>;
+            if (!CanConvertToCpp<Type>(value)) {
+                return tryToCpp<I + 1>(value);
+            }
             try {
                 return ConvertToCpp<Type>(value);
             } catch (JsException const&) {
@@ -243,6 +500,8 @@ struct TypeConverter<std::monostate> {
         }
         [[unlikely]] throw JsException{JsException::Type::TypeError, "Expected null/undefined for std::monostate"};
     }
+
+    static bool canConvert(ValueRef value) { return value->isUndefined() || value->isNull(); }
 };
 
 
@@ -264,6 +523,8 @@ struct TypeConverter<std::pair<Ty1, Ty2>> {
         auto array = value.asArray();
         return std::make_pair(ConvertToCpp<Ty1>(array.get(0)), ConvertToCpp<Ty2>(array.get(1)));
     }
+
+    static bool canConvert(ValueRef value) { return value->isArray() && value->asArray().length() == 2; }
 };
 
 
@@ -335,5 +596,17 @@ template <typename T>
     }
 }
 
+template <typename T>
+[[nodiscard]] inline bool CanConvertToCpp(ValueRef value) {
+    using Conv = internal::RawTypeConverter<T>;
+    if constexpr (HasCanConvert<traits::RawType_t<T>>) {
+        return Conv::canConvert(value);
+    } else {
+        return true; // 未提供探测接口，由 toCpp 决定
+    }
+}
+
 
 } // namespace qjspp::bind
+
+#include "adapter/FunctionAdapter.hpp" // bindStaticFunction，依赖上方的 ConvertToJs / ConvertToCpp
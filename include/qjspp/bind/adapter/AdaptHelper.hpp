@@ -1,6 +1,7 @@
 #pragma once
 #include "qjspp/bind/TypeConverter.hpp"
 #include "qjspp/types/Arguments.hpp"
+#include "qjspp/types/ValueRef.hpp"
 
 namespace qjspp::bind::adapter {
 
@@ -15,7 +16,7 @@ namespace qjspp::bind::adapter {
 
 // 辅助模板：根据 ConvertToCpp<T> 的返回类型决定存储类型
 template <typename T>
-using ConvertReturnType = decltype(ConvertToCpp<T>(std::declval<Arguments const&>()[std::declval<size_t>()]));
+using ConvertReturnType = decltype(ConvertToCpp<T>(std::declval<Arguments const&>().at(std::declval<size_t>())));
 
 template <typename T>
 using TupleElementType = std::conditional_t<
@@ -42,8 +43,21 @@ inline decltype(auto) ConvertArgsToTuple(Arguments const& args, std::index_seque
     // using ResultTuple = std::tuple<TupleElementType<std::tuple_element_t<Is, Tuple>>...>;
     // return ResultTuple(ConvertToCpp<std::tuple_element_t<Is, Tuple>>(args[Is])...);
 
+    // 参数以 ValueRef 借用，转换过程不产生 Value 临时对象与引用计数操作
     using ResultTuple = std::tuple<TupleElementType<std::tuple_element_t<Is, Tuple>>...>;
-    return ResultTuple(ConvertToCpp<std::tuple_element_t<Is, Tuple>>(args[Is])...);
+    return ResultTuple(ConvertToCpp<std::tuple_element_t<Is, Tuple>>(args.at(Is))...);
+}
+
+// 探测参数能否转换为 Tuple 中的类型 (参数个数 + TypeConverter::canConvert)，不抛出异常
+template <typename Tuple>
+inline bool CanConvertArgs(Arguments const& args) {
+    constexpr size_t N = std::tuple_size_v<Tuple>;
+    if (args.length() != N) {
+        return false;
+    }
+    return [&]<size_t... Is>(std::index_sequence<Is...>) {
+        return (CanConvertToCpp<std::tuple_element_t<Is, Tuple>>(args.at(Is)) && ...);
+    }(std::make_index_sequence<N>());
 }
 
 
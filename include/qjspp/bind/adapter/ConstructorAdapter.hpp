@@ -20,9 +20,8 @@ InstanceConstructor bindInstanceConstructor() {
             return new C();
 
         } else {
-            if (args.length() != N) return nullptr; // Parameter mismatch
-
             using Tuple = std::tuple<Args...>;
+            if (!CanConvertArgs<Tuple>(args)) return nullptr; // Parameter mismatch (count or type)
 
             auto parameters = ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>());
             return std::apply(
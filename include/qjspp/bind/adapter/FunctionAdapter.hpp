@@ -3,60 +3,85 @@
 #include "qjspp/bind/TypeConverter.hpp"
 #include "qjspp/bind/adapter/AdaptHelper.hpp"
 #include "qjspp/concepts/ScriptConcepts.hpp"
+#include "qjspp/runtime/JsException.hpp"
 #include "qjspp/traits/FunctionTraits.hpp"
 #include "qjspp/types/Arguments.hpp"
 
+#include <array>
+#include <vector>
+
 namespace qjspp::bind::adapter {
 
 template <typename Tuple, std::size_t... Is>
 inline decltype(auto) ConvertArgsToTuple(Arguments const& args, std::index_sequence<Is...>);
 
+template <typename Tuple>
+inline bool CanConvertArgs(Arguments const& args);
+
+// 运行时绑定与编译期绑定共用的调用体
+template <typename Func>
+Value invokeStaticFunction(Func const& f, Arguments const& args) {
+    using Traits       = traits::FunctionTraits<std::decay_t<Func>>;
+    using R            = typename Traits::ReturnType;
+    using Tuple        = typename Traits::ArgsTuple;
+    constexpr size_t N = std::tuple_size_v<Tuple>;
+
+    // 参数校验失败是脚本侧的常见错误，直接抛入引擎，不构造 C++ 异常
+    if (args.length() != N) [[unlikely]] {
+        return JsException::raise(JsException::Type::TypeError, "argument count mismatch");
+    }
+    if (!CanConvertArgs<Tuple>(args)) [[unlikely]] {
+        return JsException::raise(JsException::Type::TypeError, "argument type mismatch");
+    }
+
+    if constexpr (std::is_void_v<R>) {
+        std::apply(f, ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>()));
+        return {}; // undefined
+    } else {
+        decltype(auto) ret = std::apply(f, ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>()));
+        return ConvertToJs(ret);
+    }
+}
+
 template <typename Func>
 FunctionCallback bindStaticFunction(Func&& func) {
     if constexpr (concepts::JsFunctionCallback<Func>) {
         return std::forward<Func>(func);
     }
-    return [f = std::forward<Func>(func)](Arguments const& args) -> Value {
-        using Traits       = traits::FunctionTraits<std::decay_t<Func>>;
-        using R            = typename Traits::ReturnType;
-        using Tuple        = typename Traits::ArgsTuple;
-        constexpr size_t N = std::tuple_size_v<Tuple>;
-
-        if (args.length() != N) [[unlikely]] {
-            throw JsException(JsException::Type::TypeError, "argument count mismatch");
-        }
+    return [f = std::forward<Func>(func)](Arguments const& args) -> Value { return invokeStaticFunction(f, args); };
+}
 
-        if constexpr (std::is_void_v<R>) {
-            std::apply(f, ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>()));
-            return {}; // undefined
-        } else {
-            decltype(auto) ret = std::apply(f, ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>()));
-            return ConvertToJs(ret);
-        }
-    };
+// 编译期成员表 (meta::MemberEntry) 的调用体：函数指针作为模板参数，静态成员忽略 inst
+template <auto Fn>
+Value staticFunctionThunk(void* /* inst */, Arguments const& args) {
+    return invokeStaticFunction(Fn, args);
+}
+
+// 重载候选的快速匹配: 参数个数与类型标签均符合时才尝试调用
+template <typename Func>
+bool canInvokeStaticFunction(Arguments const& args) {
+    if constexpr (concepts::JsFunctionCallback<Func>) {
+        return true;
+    } else {
+        return CanConvertArgs<typename traits::FunctionTraits<std::decay_t<Func>>::ArgsTuple>(args);
+    }
 }
 
 template <typename... Func>
 FunctionCallback bindStaticOverloadedFunction(Func&&... funcs) {
     std::vector functions = {bindStaticFunction(std::forward<Func>(funcs))...};
+    std::array  probes    = {&canInvokeStaticFunction<Func>...};
 
-    // TODO: consider optimizing overload dispatch (e.g. arg-count lookup)
-    // if we ever hit cases with >3 overloads. Current linear dispatch is ideal
-    // for small sets and keeps the common path fast.
-
-    return [fs = std::move(functions)](Arguments const& args) -> Value {
+    return [fs = std::move(functions), probes](Arguments const& args) -> Value {
         for (size_t i = 0; i < sizeof...(Func); ++i) {
-            try {
-                return std::invoke(fs[i], args);
-            } catch (JsException const&) {
-                if (i == sizeof...(Func) - 1) [[unlikely]] {
-                    throw JsException{JsException::Type::TypeError, "no overload found"};
-                }
+            if (!probes[i](args)) {
+                continue; // 不匹配的候选直接跳过，不产生异常
             }
+            // 探测通过即选定该候选：其返回值或异常 (含挂起的 JavaScript 异常) 原样传播，不再尝试后续候选
+            return std::invoke(fs[i], args);
         }
-        return {}; // undefined
+        return JsException::raise(JsException::Type::TypeError, "no overload found");
     };
 }
 
-
 } // namespace qjspp::bind::adapter
\ No newline at end of file
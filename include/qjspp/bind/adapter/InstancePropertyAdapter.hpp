@@ -5,6 +5,10 @@
 #include "qjspp/reflection/TypeId.hpp"
 #include "qjspp/traits/FunctionTraits.hpp"
 #include "qjspp/types/Arguments.hpp"
+#include "qjspp/types/ValueRef.hpp"
+
+#include <atomic>
+#include <cstdint>
 
 namespace qjspp::bind::adapter {
 
@@ -21,7 +25,7 @@ template <typename C, typename Fn>
 InstanceSetterCallback bindInstanceSetter(Fn&& fn) {
     using Ty = traits::ArgumentType_t<Fn, 1>; // (void* inst, Ty val)
     return [f = std::forward<Fn>(fn)](void* inst, Arguments const& args) -> void {
-        std::invoke(f, static_cast<C*>(inst), ConvertToCpp<Ty>(args[0]));
+        std::invoke(f, static_cast<C*>(inst), ConvertToCpp<Ty>(args.at(0)));
     };
 }
 
@@ -41,9 +45,32 @@ std::pair<InstanceGetterCallback, InstanceSetterCallback> bindInstanceProperty(T
     }
 }
 
+// 编译期成员表 (meta::MemberEntry) 的 getter / setter：成员指针作为模板参数
+template <typename C, auto Member>
+Value instancePropertyGetterThunk(void* inst, Arguments const& /* args */) {
+    using Ty = std::remove_reference_t<decltype(std::declval<C&>().*Member)>;
+    static_assert(
+        std::copyable<traits::RawType_t<Ty>>,
+        "instancePropertyGetterThunk only supports copying properties, Ty does not support copying."
+    );
+    return ConvertToJs(static_cast<std::remove_cv_t<Ty>>(static_cast<C*>(inst)->*Member));
+}
+
+template <typename C, auto Member>
+void instancePropertySetterThunk(void* inst, Arguments const& args) {
+    using Ty = std::remove_reference_t<decltype(std::declval<C&>().*Member)>;
+    static_cast<C*>(inst)->*Member = ConvertToCpp<Ty>(args.at(0));
+}
+
+// 为每个引用属性分配进程内唯一的槽位，作为成员包装对象缓存的键 (同一偏移可能对应多个属性)
+inline uint32_t nextMemberSlot() {
+    static std::atomic_uint32_t next{0};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
 template <typename C, typename Fn>
 InstanceGetterCallback bindInstanceGetterRef(Fn&& fn, meta::ClassDefine const* def) {
-    return [f = std::forward<Fn>(fn), def](void* inst, Arguments const& arguments) {
+    return [f = std::forward<Fn>(fn), def, slot = nextMemberSlot()](void* inst, Arguments const& arguments) {
         using Ret = traits::FunctionTraits<std::decay_t<Fn>>::ReturnType;
         static_assert(std::is_pointer_v<Ret>, "InstanceGetterRef must return a pointer");
 
@@ -64,11 +91,16 @@ InstanceGetterCallback bindInstanceGetterRef(Fn&& fn, meta::ClassDefine const* d
         decltype(auto) result = std::invoke(f, static_cast<C*>(inst)); // const T* / T*
 
         void* unk = nullptr;
-        if constexpr (std::is_const_v<Ret>) {
+        if constexpr (std::is_const_v<std::remove_pointer_t<Ret>>) {
             unk = const_cast<void*>(static_cast<const void*>(result));
         } else {
             unk = static_cast<void*>(result);
         }
+        // 指向实例内部的子对象按属性槽位缓存于 owner，重复访问不再创建新的包装对象
+        auto offset = reinterpret_cast<uintptr_t>(unk) - reinterpret_cast<uintptr_t>(inst);
+        if (unk != nullptr && offset < sizeof(C)) {
+            return arguments.engine()->newInstanceOfMember(*def, unk, arguments.thiz(), slot);
+        }
         return arguments.engine()->newInstanceOfView(*def, unk, arguments.thiz());
     };
 }
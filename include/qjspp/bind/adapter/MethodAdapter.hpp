@@ -1,80 +1,102 @@
 #pragma once
 #include "qjspp/Forward.hpp"
+#include "qjspp/bind/adapter/AdaptHelper.hpp"
 #include "qjspp/concepts/ScriptConcepts.hpp"
 #include "qjspp/runtime/JsException.hpp"
 #include "qjspp/traits/FunctionTraits.hpp"
 #include "qjspp/types/Arguments.hpp"
 #include "qjspp/types/Value.hpp"
 
+#include <array>
 #include <cassert>
+#include <vector>
 
 namespace qjspp::bind::adapter {
 
 
+// 运行时绑定与编译期绑定共用的调用体
+template <typename C, typename Func>
+Value invokeInstanceMethod(Func const& f, void* inst, Arguments const& args) {
+    using Traits       = traits::FunctionTraits<std::decay_t<Func>>;
+    using R            = typename Traits::ReturnType;
+    using Tuple        = typename Traits::ArgsTuple;
+    constexpr size_t N = std::tuple_size_v<Tuple>;
+
+    // 参数校验失败是脚本侧的常见错误，直接抛入引擎，不构造 C++ 异常
+    if (args.length() != N) [[unlikely]] {
+        return JsException::raise(JsException::Type::TypeError, "argument count mismatch");
+    }
+    if (!CanConvertArgs<Tuple>(args)) [[unlikely]] {
+        return JsException::raise(JsException::Type::TypeError, "argument type mismatch");
+    }
+
+    auto typedInstance = static_cast<C*>(inst);
+
+    if constexpr (std::is_void_v<R>) {
+        std::apply(
+            [typedInstance, &f](auto&&... unpackedArgs) {
+                (typedInstance->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
+            },
+            ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>())
+        );
+        return {}; // undefined
+    } else {
+        decltype(auto) ret = std::apply(
+            [typedInstance, &f](auto&&... unpackedArgs) -> R {
+                return (typedInstance->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
+            },
+            ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>())
+        );
+        // 特殊情况，对于 Builder 模式，返回 this
+        if constexpr (std::is_same_v<R, C&>) {
+            assert(args.hasThiz() && "this is required for Builder pattern");
+            return args.thiz();
+        } else {
+            return ConvertToJs(ret);
+        }
+    }
+}
+
 template <typename C, typename Func>
 InstanceMethodCallback bindInstanceMethod(Func&& fn) {
     if constexpr (concepts::JsInstanceMethodCallback<std::remove_cvref_t<Func>>) {
         return std::forward<Func>(fn); // 已是标准的回调，直接转发不需要进行绑定
     }
     return [f = std::forward<Func>(fn)](void* inst, const Arguments& args) -> Value {
-        using Traits       = traits::FunctionTraits<std::decay_t<Func>>;
-        using R            = typename Traits::ReturnType;
-        using Tuple        = typename Traits::ArgsTuple;
-        constexpr size_t N = std::tuple_size_v<Tuple>;
-
-        if (args.length() != N) [[unlikely]] {
-            throw JsException(JsException::Type::TypeError, "argument count mismatch");
-        }
+        return invokeInstanceMethod<C>(f, inst, args);
+    };
+}
 
-        auto typedInstance = static_cast<C*>(inst);
+// 编译期成员表 (meta::MemberEntry) 的调用体：成员函数指针作为模板参数，调用点可直接内联
+template <typename C, auto Fn>
+Value instanceMethodThunk(void* inst, Arguments const& args) {
+    return invokeInstanceMethod<C>(Fn, inst, args);
+}
 
-        if constexpr (std::is_void_v<R>) {
-            std::apply(
-                [typedInstance, &f](auto&&... unpackedArgs) {
-                    (typedInstance->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
-                },
-                ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>())
-            );
-            return {}; // undefined
-        } else {
-            decltype(auto) ret = std::apply(
-                [typedInstance, &f](auto&&... unpackedArgs) -> R {
-                    return (typedInstance->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
-                },
-                ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>())
-            );
-            // 特殊情况，对于 Builder 模式，返回 this
-            if constexpr (std::is_same_v<R, C&>) {
-                assert(args.hasThiz() && "this is required for Builder pattern");
-                return args.thiz();
-            } else {
-                return ConvertToJs(ret);
-            }
-        }
-    };
+template <typename Func>
+bool canInvokeInstanceMethod(Arguments const& args) {
+    if constexpr (concepts::JsInstanceMethodCallback<std::remove_cvref_t<Func>>) {
+        return true;
+    } else {
+        return CanConvertArgs<typename traits::FunctionTraits<std::decay_t<Func>>::ArgsTuple>(args);
+    }
 }
 
 template <typename C, typename... Func>
 InstanceMethodCallback bindInstanceOverloadedMethod(Func&&... funcs) {
     std::vector functions = {bindInstanceMethod<C>(std::forward<Func>(funcs))...};
+    std::array  probes    = {&canInvokeInstanceMethod<Func>...};
 
-    // TODO: consider optimizing overload dispatch (e.g. arg-count lookup)
-    // if we ever hit cases with >3 overloads. Current linear dispatch is ideal
-    // for small sets and keeps the common path fast.
-
-    return [fs = std::move(functions)](void* inst, Arguments const& args) -> Value {
+    return [fs = std::move(functions), probes](void* inst, Arguments const& args) -> Value {
         for (size_t i = 0; i < sizeof...(Func); ++i) {
-            try {
-                return std::invoke(fs[i], inst, args);
-            } catch (JsException const&) {
-                if (i == sizeof...(Func) - 1) [[unlikely]] {
-                    throw JsException{JsException::Type::TypeError, "no overload found"};
-                }
+            if (!probes[i](args)) {
+                continue; // 不匹配的候选直接跳过，不产生异常
             }
+            // 探测通过即选定该候选：其返回值或异常 (含挂起的 JavaScript 异常) 原样传播，不再尝试后续候选
+            return std::invoke(fs[i], inst, args);
         }
-        return {}; // undefined
+        return JsException::raise(JsException::Type::TypeError, "no overload found");
     };
 }
 
-
 } // namespace qjspp::bind::adapter
\ No newline at end of file
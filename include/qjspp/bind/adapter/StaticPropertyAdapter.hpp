@@ -3,6 +3,7 @@
 #include "qjspp/bind/TypeConverter.hpp"
 #include "qjspp/traits/FunctionTraits.hpp"
 #include "qjspp/traits/TypeTraits.hpp"
+#include "qjspp/types/Arguments.hpp"
 #include "qjspp/types/Value.hpp"
 
 namespace qjspp::bind::adapter {
@@ -39,5 +40,21 @@ std::pair<GetterCallback, SetterCallback> bindStaticProperty(Ty* p) {
     }
 }
 
+// 编译期成员表 (meta::MemberEntry) 的 getter / setter：变量地址作为模板参数，静态成员忽略 inst
+template <auto P>
+Value staticPropertyGetterThunk(void* /* inst */, Arguments const& /* args */) {
+    using Ty = std::remove_pointer_t<decltype(P)>;
+    static_assert(
+        std::copyable<traits::RawType_t<Ty>>,
+        "Static property must be copyable; otherwise, a getter/setter must be specified."
+    );
+    return ConvertToJs(static_cast<std::remove_cv_t<Ty>>(*P));
+}
+
+template <auto P>
+void staticPropertySetterThunk(void* /* inst */, Arguments const& args) {
+    *P = ConvertToCpp<std::remove_pointer_t<decltype(P)>>(args.at(0));
+}
+
 
 } // namespace qjspp::bind::adapter
\ No newline at end of file
@@ -6,9 +6,12 @@
 #include "qjspp/bind/adapter/InstancePropertyAdapter.hpp"
 #include "qjspp/bind/adapter/MethodAdapter.hpp"
 #include "qjspp/bind/adapter/StaticPropertyAdapter.hpp"
+#include "qjspp/bind/builder/MemberTableBuilder.hpp"
 #include "qjspp/bind/meta/MemberDefine.hpp"
+#include "qjspp/bind/meta/MemberTable.hpp"
 #include "qjspp/concepts/ScriptConcepts.hpp"
 
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -35,7 +38,10 @@ private:
     std::vector<meta::StaticMemberDefine::Function>   staticFunctions_;
     std::vector<meta::InstanceMemberDefine::Property> instanceProperty_;
     std::vector<meta::InstanceMemberDefine::Method>   instanceFunctions_;
-    meta::ClassDefine const*                          base_ = nullptr;
+    std::span<meta::MemberEntry const>                memberTable_            = {};
+    meta::ClassDefine const*                          base_                   = nullptr;
+    bool                                              identityCache_          = false;
+    bool                                              threadSafeDestructible_ = false;
 
     InstanceConstructor                                          userDefinedConstructor_ = nullptr;
     std::unordered_map<size_t, std::vector<InstanceConstructor>> constructors_           = {};
@@ -49,7 +55,10 @@ private:
       staticFunctions_(std::move(other.staticFunctions_)),
       instanceProperty_(std::move(other.instanceProperty_)),
       instanceFunctions_(std::move(other.instanceFunctions_)),
+      memberTable_(other.memberTable_),
       base_(other.base_),
+      identityCache_(other.identityCache_),
+      threadSafeDestructible_(other.threadSafeDestructible_),
       userDefinedConstructor_(std::move(other.userDefinedConstructor_)),
       constructors_(std::move(other.constructors_)) {
         // note: other may be in moved-from state
@@ -231,6 +240,44 @@ public:
         return *this;
     }
 
+    /**
+     * 挂载编译期成员表 / Attach a compile-time member table (see defineMembers)
+     * @note 表中的名称与回调均为常量，ClassDefine 只保存其引用，不复制到堆上
+     * @note table 须为静态存储期的 constexpr 变量，每个类只能挂载一张表
+     */
+    template <std::size_t N>
+    auto& members(meta::MemberTable<Class, N> const& table) {
+        memberTable_ = table.entries_;
+        return *this;
+    }
+    template <std::size_t N>
+    auto& members(meta::MemberTable<Class, N> const&&) = delete;
+
+    /**
+     * 启用身份缓存 / Enable native pointer -> wrapper identity cache
+     * @note 同一原生指针多次通过 newInstanceOf* 传入 JavaScript 时返回同一个包装对象
+     * @note 已有包装对象不持有实例 (View / Weak) 时，随后传入的 Raw / Unique / Shared 由该包装对象接管
+     * @note 重复所有权 (除两次 Shared 外) 会抛出 std::logic_error，实例仍归已有包装对象所有
+     */
+    auto& enableIdentityCache(bool enable = true)
+        requires isInstanceClass
+    {
+        identityCache_ = enable;
+        return *this;
+    }
+
+    /**
+     * 声明原生析构线程安全 / Allow native destruction on a background thread
+     * @note 包装对象被 GC 后，实例 (Raw / Unique / Shared) 在后台线程析构，不阻塞脚本执行
+     * @note 析构函数中不得访问 JsEngine 或任何 JavaScript 值
+     */
+    auto& threadSafeDestructible(bool enable = true)
+        requires isInstanceClass
+    {
+        threadSafeDestructible_ = enable;
+        return *this;
+    }
+
     [[nodiscard]] meta::ClassDefine build() {
         InstanceConstructor ctor = nullptr;
         if constexpr (isInstanceClass) {
@@ -290,7 +337,10 @@ public:
             },
             base_,
             std::move(typeId),
-            factory
+            factory,
+            identityCache_,
+            threadSafeDestructible_,
+            memberTable_
         };
     }
 };
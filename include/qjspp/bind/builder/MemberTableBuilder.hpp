@@ -0,0 +1,90 @@
+#pragma once
+#include "qjspp/bind/adapter/FunctionAdapter.hpp"
+#include "qjspp/bind/adapter/InstancePropertyAdapter.hpp"
+#include "qjspp/bind/adapter/MethodAdapter.hpp"
+#include "qjspp/bind/adapter/StaticPropertyAdapter.hpp"
+#include "qjspp/bind/meta/MemberTable.hpp"
+
+#include <concepts>
+#include <string_view>
+#include <type_traits>
+
+
+namespace qjspp::bind {
+
+
+/**
+ * 编译期成员表的表项工厂 / Compile-time member entries of class C
+ * 成员作为模板参数，每个成员只生成一个无捕获的调用体，工厂本身为 consteval，不产生运行时代码
+ * @note C 为 void 时只能声明静态成员
+ *
+ * @code
+ * using M = qjspp::bind::MemberOf<Foo>;
+ * constexpr auto FooMembers = qjspp::bind::defineMembers<Foo>(
+ *     M::instanceProperty<&Foo::x>("x"),
+ *     M::instanceMethod<&Foo::bar>("bar"),
+ *     M::function<&Foo::baz>("baz")
+ * );
+ * auto FooDefine = qjspp::bind::defineClass<Foo>("Foo").constructor<>().members(FooMembers).build();
+ * @endcode
+ */
+template <typename C>
+struct MemberOf {
+    // 携带所属类型的表项，defineMembers 据此拒绝其它类的成员
+    struct Entry {
+        meta::MemberEntry value_;
+    };
+
+    // 静态方法 / Static function: M::function<&Foo::bar>("bar")
+    template <auto Fn>
+        requires(std::is_pointer_v<decltype(Fn)> && std::is_function_v<std::remove_pointer_t<decltype(Fn)>>)
+    static consteval Entry function(std::string_view name) {
+        return {{meta::MemberEntry::Kind::Function, name, &adapter::staticFunctionThunk<Fn>}};
+    }
+
+    // 静态属性 / Static property: M::property<&Foo::value>("value")，const 变量为只读
+    template <auto P>
+        requires(std::is_pointer_v<decltype(P)> && std::is_object_v<std::remove_pointer_t<decltype(P)>>)
+    static consteval Entry property(std::string_view name) {
+        meta::MemberEntry::Setter setter = nullptr;
+        if constexpr (!std::is_const_v<std::remove_pointer_t<decltype(P)>>) {
+            setter = &adapter::staticPropertySetterThunk<P>;
+        }
+        return {{meta::MemberEntry::Kind::Property, name, &adapter::staticPropertyGetterThunk<P>, setter}};
+    }
+
+    // 实例方法 / Instance method: M::instanceMethod<&Foo::bar>("bar")
+    template <auto Fn>
+        requires(!std::is_void_v<C> && std::is_member_function_pointer_v<decltype(Fn)>)
+    static consteval Entry instanceMethod(std::string_view name) {
+        return {{meta::MemberEntry::Kind::InstanceMethod, name, &adapter::instanceMethodThunk<C, Fn>}};
+    }
+
+    // 实例属性 / Instance property: M::instanceProperty<&Foo::x>("x")，const 成员为只读
+    template <auto Member>
+        requires(!std::is_void_v<C> && std::is_member_object_pointer_v<decltype(Member)>)
+    static consteval Entry instanceProperty(std::string_view name) {
+        using Ty = std::remove_reference_t<decltype(std::declval<C&>().*Member)>;
+
+        meta::MemberEntry::Setter setter = nullptr;
+        if constexpr (!std::is_const_v<Ty>) {
+            setter = &adapter::instancePropertySetterThunk<C, Member>;
+        }
+        return {
+            {meta::MemberEntry::Kind::InstanceProperty, name, &adapter::instancePropertyGetterThunk<C, Member>, setter}
+        };
+    }
+};
+
+/**
+ * 由 MemberOf<C> 的表项组成类 C 的编译期成员表
+ * @note 结果应保存为命名空间作用域的 constexpr 变量，再通过 ClassDefineBuilder::members 挂到类定义上
+ */
+template <typename C, typename... Entries>
+    requires(std::same_as<Entries, typename MemberOf<C>::Entry> && ...)
+consteval auto defineMembers(Entries... entries) {
+    return meta::MemberTable<C, sizeof...(Entries)>{{entries.value_...}};
+}
+
+
+} // namespace qjspp::bind
\ No newline at end of file
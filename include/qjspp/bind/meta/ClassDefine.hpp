@@ -1,9 +1,11 @@
 #pragma once
 #include "MemberDefine.hpp"
+#include "MemberTable.hpp"
 #include "qjspp/bind/JsManagedResource.hpp"
 #include "qjspp/reflection/TypeId.hpp"
 
 #include <memory>
+#include <span>
 #include <stdexcept>
 #include <string>
 
@@ -28,6 +30,16 @@ public:
     using ManagedResourceFactory = std::unique_ptr<struct JsManagedResource> (*)(void* instance);
     ManagedResourceFactory const factory_{nullptr};
 
+    // 身份缓存：同一原生指针重复传入 JavaScript 时复用已存在的包装对象 (保持 === 语义)
+    // 由 BindRegistry 维护，包装对象被 GC 时移除
+    bool const identityCache_{false};
+
+    // 原生析构可在后台线程执行 (JsEngine 的延迟析构队列)，析构函数不得访问引擎
+    bool const threadSafeDestructible_{false};
+
+    // 编译期成员表 (ClassDefineBuilder::members)，与 staticMemberDef_ / instanceMemberDef_ 一同注册
+    std::span<MemberEntry const> const memberTable_{};
+
     [[nodiscard]] inline auto manage(void* instance) const {
         if (!factory_) [[unlikely]] {
             throw std::logic_error(
@@ -38,19 +50,25 @@ public:
     }
 
     explicit ClassDefine(
-        std::string            name,
-        StaticMemberDefine     staticDef,
-        InstanceMemberDefine   instanceDef,
-        ClassDefine const*     base,
-        reflection::TypeId     typeId,
-        ManagedResourceFactory factory
+        std::string                  name,
+        StaticMemberDefine           staticDef,
+        InstanceMemberDefine         instanceDef,
+        ClassDefine const*           base,
+        reflection::TypeId           typeId,
+        ManagedResourceFactory       factory,
+        bool                         identityCache          = false,
+        bool                         threadSafeDestructible = false,
+        std::span<MemberEntry const> memberTable            = {}
     )
     : name_(std::move(name)),
       staticMemberDef_(std::move(staticDef)),
       instanceMemberDef_(std::move(instanceDef)),
       base_(base),
       typeId_(std::move(typeId)),
-      factory_(factory) {}
+      factory_(factory),
+      identityCache_(identityCache),
+      threadSafeDestructible_(threadSafeDestructible),
+      memberTable_(memberTable) {}
 };
 
 
@@ -0,0 +1,49 @@
+#pragma once
+#include "qjspp/Forward.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+namespace qjspp::bind::meta {
+
+
+/**
+ * 编译期成员表的表项 / Entry of a compile-time member table
+ * 名称为 string_view，回调为每个成员生成的普通函数指针，可作为 constexpr 常量放入只读数据段
+ * @note 由 bind::MemberOf<C> 生成，见 bind::defineMembers
+ */
+struct MemberEntry {
+    enum class Kind : uint8_t {
+        Function,        // 静态方法
+        Property,        // 静态属性
+        InstanceMethod,  // 实例方法
+        InstanceProperty // 实例属性
+    };
+
+    using Callback = Value (*)(void* inst, Arguments const& args); // 方法调用 / 属性 getter，静态成员 inst 为 nullptr
+    using Setter   = void (*)(void* inst, Arguments const& args);  // 新值为 args[0]
+
+    Kind             kind_;
+    std::string_view name_;
+    Callback         callback_{nullptr};
+    Setter           setter_{nullptr}; // 只读属性与方法为 nullptr
+
+    [[nodiscard]] constexpr bool isInstance() const {
+        return kind_ == Kind::InstanceMethod || kind_ == Kind::InstanceProperty;
+    }
+};
+
+/**
+ * 类 C 的编译期成员表，ClassDefine 仅保存其引用，不产生静态初始化与堆分配
+ * @note 必须声明为静态存储期的 constexpr 变量，见 ClassDefineBuilder::members
+ */
+template <typename C, std::size_t N>
+struct MemberTable {
+    std::array<MemberEntry, N> entries_;
+};
+
+
+} // namespace qjspp::bind::meta
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include <concepts>
+#include <cstddef>
 #include <string_view>
 #include <type_traits>
 
@@ -13,6 +14,22 @@ concept NumberLike = std::is_arithmetic_v<T>;
 template <typename T>
 concept StringLike = std::convertible_to<T, std::string_view>;
 
+// 以字符串为键的关联容器 (std::map / std::unordered_map / flat_map 等)
+template <typename T>
+concept StringKeyedMap = requires {
+    typename T::key_type;
+    typename T::mapped_type;
+} && StringLike<typename T::key_type> && std::constructible_from<typename T::key_type, std::string_view>;
+
+// 基于有序数组的关联容器 (std::flat_map、boost::container::flat_map 等)，无节点类型，逐个无序插入为 O(n^2)
+template <typename T>
+concept SortedVectorMap = StringKeyedMap<T> && requires { typename T::key_compare; } && !requires {
+    typename T::node_type;
+};
+
+template <typename T>
+concept HasReserve = requires(T& container, std::size_t size) { container.reserve(size); };
+
 template <typename T>
 concept HasDefaultConstructor = requires { T{}; };
 
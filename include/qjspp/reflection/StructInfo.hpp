@@ -0,0 +1,113 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace qjspp::reflection {
+
+
+/**
+ * 结构体字段描述: 字段名 + 成员指针
+ */
+template <typename C, typename M>
+struct StructField {
+    using ClassType  = C;
+    using MemberType = M;
+
+    std::string_view name;
+    M C::*           member;
+};
+
+template <typename C, typename M>
+[[nodiscard]] constexpr StructField<C, M> field(std::string_view name, M C::* member) noexcept {
+    return StructField<C, M>{name, member};
+}
+
+/**
+ * 结构体反射信息，由 QJSPP_STRUCT 特化
+ * 特化需提供: using type; static constexpr auto fields() -> std::tuple<StructField...>
+ */
+template <typename T>
+struct StructInfo;
+
+template <typename T>
+concept ReflectableStruct = requires {
+    typename StructInfo<T>::type;
+    StructInfo<T>::fields();
+};
+
+template <ReflectableStruct T>
+inline constexpr std::size_t StructFieldCount_v = std::tuple_size_v<decltype(StructInfo<T>::fields())>;
+
+template <ReflectableStruct T>
+[[nodiscard]] constexpr auto getStructFieldNames() noexcept {
+    return std::apply(
+        [](auto const&... fields) { return std::array<std::string_view, sizeof...(fields)>{fields.name...}; },
+        StructInfo<T>::fields()
+    );
+}
+
+
+} // namespace qjspp::reflection
+
+
+// clang-format off
+#define QJSPP_PP_EXPAND(x) x
+#define QJSPP_PP_CONCAT_IMPL(a, b) a##b
+#define QJSPP_PP_CONCAT(a, b) QJSPP_PP_CONCAT_IMPL(a, b)
+#define QJSPP_PP_ARG_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, N, ...) N
+#define QJSPP_PP_COUNT(...) QJSPP_PP_EXPAND(QJSPP_PP_ARG_N(__VA_ARGS__, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+
+#define QJSPP_PP_FOR_EACH_1(m, x) m(x)
+#define QJSPP_PP_FOR_EACH_2(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_1(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_3(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_2(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_4(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_3(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_5(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_4(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_6(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_5(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_7(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_6(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_8(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_7(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_9(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_8(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_10(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_9(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_11(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_10(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_12(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_11(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_13(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_12(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_14(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_13(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_15(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_14(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_16(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_15(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_17(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_16(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_18(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_17(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_19(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_18(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_20(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_19(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_21(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_20(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_22(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_21(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_23(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_22(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_24(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_23(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_25(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_24(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_26(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_25(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_27(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_26(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_28(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_27(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_29(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_28(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_30(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_29(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_31(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_30(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH_32(m, x, ...) m(x), QJSPP_PP_EXPAND(QJSPP_PP_FOR_EACH_31(m, __VA_ARGS__))
+#define QJSPP_PP_FOR_EACH(m, ...) QJSPP_PP_EXPAND(QJSPP_PP_CONCAT(QJSPP_PP_FOR_EACH_, QJSPP_PP_COUNT(__VA_ARGS__))(m, __VA_ARGS__))
+// clang-format on
+
+#define QJSPP_STRUCT_FIELD_(member) ::qjspp::reflection::field(#member, &type::member)
+
+/**
+ * 声明结构体的字段列表，生成 C++ struct <-> JavaScript plain object 的 TypeConverter
+ * @code QJSPP_STRUCT(Point, x, y);
+ * @note 需在全局命名空间中使用，Type 需要可默认构造，字段类型需要有 TypeConverter (最多 32 个字段)
+ * @note 首次转换时在引擎中缓存字段 atom，toJs 一次性以固定形状创建对象，toCpp 按 atom 读取字段
+ */
+#define QJSPP_STRUCT(Type, ...)                                                                                        \
+    template <>                                                                                                        \
+    struct qjspp::reflection::StructInfo<Type> {                                                                       \
+        using type = Type;                                                                                             \
+        static constexpr auto fields() {                                                                               \
+            return std::make_tuple(QJSPP_PP_FOR_EACH(QJSPP_STRUCT_FIELD_, __VA_ARGS__));                               \
+        }                                                                                                              \
+    }
@@ -0,0 +1,104 @@
+#pragma once
+#include "qjspp/Global.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+namespace qjspp {
+
+
+// 原生绑定的种类，用于性能分析报告
+enum class BindingKind {
+    Function,    // 静态函数 / 模块导出函数 / Function::Function
+    Method,      // 实例方法
+    Getter,      // 属性 getter
+    Setter,      // 属性 setter
+    Constructor, // 类构造函数
+};
+
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+
+/**
+ * 原生绑定调用性能分析器
+ * @note 仅在定义 QJSPP_ENABLE_BINDING_PROFILER 时编译，未定义时不产生任何插桩代码
+ * @note 统计在持有引擎锁的线程上更新，读取报告时也需要持有 Locker
+ */
+class BindingProfiler final {
+public:
+    using Clock    = std::chrono::steady_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    struct Entry {
+        std::string scope_;  // 类名 / 模块名
+        std::string member_; // 成员名
+        BindingKind kind_{BindingKind::Function};
+
+        uint64_t calls_{0};        // 调用次数
+        uint64_t exceptions_{0};   // 抛出 JsException 的次数
+        uint64_t sampledCalls_{0}; // 计时的调用次数
+        Duration sampledTime_{0};  // 计时调用的累计耗时
+        Duration maxTime_{0};      // 计时调用的最大耗时
+
+        // 按采样比例推算的累计耗时
+        [[nodiscard]] Duration totalTime() const;
+
+        [[nodiscard]] std::string name() const;
+    };
+
+    enum class SortBy { TotalTime, MaxTime, Calls, Exceptions };
+
+    class CallScope final {
+        Entry*            entry_{nullptr};
+        Clock::time_point start_{};
+
+    public:
+        QJSPP_DISABLE_COPY_MOVE(CallScope);
+        QJSPP_DISABLE_NEW();
+
+        explicit CallScope(BindingProfiler& profiler, Entry* entry);
+        ~CallScope();
+
+        void markException();
+    };
+
+    BindingProfiler() = default;
+    QJSPP_DISABLE_COPY_MOVE(BindingProfiler);
+
+    void setEnabled(bool enabled);
+
+    [[nodiscard]] bool isEnabled() const;
+
+    /**
+     * 设置采样间隔，每 interval 次调用计时一次 (调用次数与异常次数始终完整统计)
+     * @note interval <= 1 时对每次调用计时
+     */
+    void setSampleInterval(uint32_t interval);
+
+    void reset();
+
+    [[nodiscard]] std::vector<Entry> snapshot(SortBy sort = SortBy::TotalTime) const;
+
+    [[nodiscard]] std::string dumpText(SortBy sort = SortBy::TotalTime, size_t limit = 0) const;
+
+    [[nodiscard]] std::string dumpJson(SortBy sort = SortBy::TotalTime, size_t limit = 0) const;
+
+    // internal use only
+    Entry* entry(std::string_view scope, std::string_view member, BindingKind kind);
+
+private:
+    bool     enabled_{true};
+    uint32_t sampleInterval_{1};
+    uint32_t sampleCounter_{0};
+
+    std::unordered_map<std::string, Entry> entries_; // 节点地址稳定，可直接保存 Entry*
+};
+
+#endif // QJSPP_ENABLE_BINDING_PROFILER
+
+
+} // namespace qjspp
@@ -0,0 +1,110 @@
+#pragma once
+#include "qjspp/Forward.hpp"
+#include "qjspp/Global.hpp"
+#include "qjspp/runtime/StackFrame.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+namespace qjspp {
+
+class JsEngine;
+
+/**
+ * JavaScript 采样 CPU 性能分析器
+ * 计时线程按固定间隔请求采样，引擎在 QuickJS 中断回调(JS_SetInterruptHandler)中捕获当前调用栈并聚合为调用树
+ * @note 调用栈通过 Error 构造函数获取，原生绑定函数以 `(native)` 帧出现在调用栈中
+ * @note QuickJS 仅在执行字节码时轮询中断，原生函数内部耗时会计入其返回后的下一次采样
+ * @note 除计时线程外，所有接口都需要在持有 Locker 的线程上调用
+ */
+class CpuProfiler final {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::chrono::microseconds interval{1000};   // 采样间隔
+        int                       maxStackDepth{64}; // 单次采样的最大调用栈深度 (Error.stackTraceLimit)
+    };
+
+    using CallFrame = StackFrame;
+
+    struct Node {
+        int              id_{0};     // 1-based, 1 为 (root)
+        int              parent_{0}; // 0 表示无父节点
+        CallFrame        frame_;
+        uint64_t         hitCount_{0}; // 作为栈顶被采样的次数
+        std::vector<int> children_;
+    };
+
+    explicit CpuProfiler(JsEngine& engine);
+    ~CpuProfiler();
+    QJSPP_DISABLE_COPY_MOVE(CpuProfiler);
+
+    /**
+     * 开始采样，清空上一次的采样数据
+     */
+    void start();
+    void start(Options options);
+
+    void stop();
+
+    [[nodiscard]] bool isRunning() const;
+
+    void reset();
+
+    [[nodiscard]] size_t sampleCount() const;
+
+    [[nodiscard]] std::vector<Node> const& nodes() const;
+
+    /**
+     * 导出 Chrome DevTools `.cpuprofile` 格式 (nodes / samples / timeDeltas)
+     */
+    [[nodiscard]] std::string toCpuProfile() const;
+
+    /**
+     * 导出 Chrome Trace Event 格式 (chrome://tracing、Perfetto)，相邻的相同调用帧合并为一个 "X" 事件
+     */
+    [[nodiscard]] std::string toTraceEvents() const;
+
+private:
+    void onInterrupt(); // 由 JsEngine 的中断回调调用
+    void timerLoop();
+    void captureSample(Clock::time_point now);
+    void addSample(int node, Clock::time_point time);
+    int  childOf(int parent, CallFrame const& frame);
+    int  pseudoNode(std::string_view name); // (idle) / (program)
+
+    JsEngine& engine_;
+    Options   options_{};
+
+    std::atomic_bool        running_{false};
+    std::atomic_bool        samplePending_{false}; // 计时线程请求采样
+    bool                    sampling_{false};      // 防止采样过程中重入
+    std::thread             timer_;
+    std::mutex              timerMutex_;
+    std::condition_variable timerCv_;
+
+    JSValue errorCtor_{JS_UNDEFINED};
+    JSValue savedStackTraceLimit_{JS_UNDEFINED};
+
+    std::vector<Node>                    nodes_;
+    std::unordered_map<std::string, int> nodeIndex_; // "parent|frame" -> node id
+    std::vector<int>                     samples_;
+    std::vector<Clock::time_point>       timestamps_;
+    Clock::time_point                    startTime_{};
+    Clock::time_point                    endTime_{};
+
+    friend class JsEngine;
+};
+
+
+} // namespace qjspp
@@ -1,14 +1,20 @@
 #pragma once
+#include "BindingProfiler.hpp"
+#include "CpuProfiler.hpp"
 #include "TaskQueue.hpp"
 #include "qjspp/Forward.hpp"
 #include "qjspp/Global.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 
 // forward declaration
@@ -33,6 +39,8 @@ namespace detail {
 struct ModuleLoader;
 struct FunctionFactory;
 struct BindRegistry;
+class ResourcePool;
+class FinalizeQueue;
 } // namespace detail
 
 } // namespace qjspp
@@ -65,12 +73,117 @@ public:
 
     [[nodiscard]] bool isDestroying() const;
 
+    /**
+     * 获取引擎存活令牌，运行时释放后令牌失效
+     * @note 可在任意线程通过 weak_ptr::expired() 检查引擎是否已销毁 (JsCallback 等长期持有者使用)
+     * @note 通过 lock() 持有令牌期间引擎对象不会被释放 (析构函数等待令牌释放)，可安全访问 JsEngine，但只应短暂持有
+     */
+    [[nodiscard]] std::weak_ptr<void> getAliveToken() const;
+
+    /**
+     * 在任意线程释放 JS 值，不等待引擎锁
+     * @param value 已交出所有权的值 (Value::release)
+     * @note 当前线程持有本引擎的 Locker 时立即释放，否则无锁入队，在下次获取 Locker 或 TaskQueue 任务中释放
+     * @note 引擎对象必须仍然存活 (例如持有 getAliveToken 的 lock())；析构期间入队的值在运行时释放前清空
+     */
+    void releaseValue(JSValue value);
+
+    /**
+     * 获取一组缓存的属性 atom，首次调用时创建，引擎析构时释放
+     * @param slot 由 allocateAtomCacheSlot() 分配的全局槽位，每组名称使用独立槽位
+     * @note internal use only (QJSPP_STRUCT 转换器)
+     */
+    [[nodiscard]] JSAtom const* getCachedAtoms(size_t slot, std::span<std::string_view const> names);
+
+    [[nodiscard]] static size_t allocateAtomCacheSlot();
+
     void gc();
 
+    struct IdleGcOptions {
+        size_t allocationThreshold{4 * 1024 * 1024}; // 距上次 GC 的内存增长阈值 (bytes)
+        int    checkIntervalMs{100};                 // 两次空闲检查的最小间隔
+        bool   disableAutoGc{false};                 // 禁用 QuickJS 分配时触发的自动 GC，完全交由空闲调度
+    };
+
+    /**
+     * 启用空闲 GC 调度
+     * @note TaskQueue 单次循环没有到期任务时，若距上次 GC 的内存增长超过阈值则执行 GC
+     */
+    void enableIdleGc();
+    void enableIdleGc(IdleGcOptions options);
+    void disableIdleGc();
+
+    /**
+     * 尝试执行一次空闲 GC，返回是否执行了 GC
+     * @note 此函数不会阻塞：引擎被其它线程持有、处于 LatencyCriticalScope 或未达到阈值时直接返回 false
+     * @note 自行驱动事件循环(不使用 TaskQueue)时，可在帧间隙手动调用
+     */
+    bool idleGc();
+
+    /**
+     * 延迟敏感区间，作用域内空闲 GC 不会执行
+     */
+    class LatencyCriticalScope final {
+        JsEngine* engine_;
+
+    public:
+        QJSPP_DISABLE_COPY_MOVE(LatencyCriticalScope);
+        QJSPP_DISABLE_NEW();
+
+        explicit LatencyCriticalScope(JsEngine& engine);
+        explicit LatencyCriticalScope(JsEngine* engine);
+        ~LatencyCriticalScope();
+    };
+
+    /**
+     * 设置单次执行的时间上限，0 表示不限制 (默认)
+     * @note 期限从最外层的执行入口开始计时 (eval / loadScript / Function::call / 微任务循环)
+     * @note 超时后脚本在下一次中断检查时被终止，入口处抛出 JsException (Type::Terminated)，JavaScript 侧无法捕获
+     */
+    void setExecutionTimeout(std::chrono::milliseconds timeout);
+
+    [[nodiscard]] std::chrono::milliseconds getExecutionTimeout() const;
+
+    /**
+     * 终止正在执行的 JavaScript，可在任意线程调用
+     * @note 若当前没有正在执行的脚本，则作用于下一次执行
+     */
+    void terminate();
+
+    /**
+     * 执行期限区间，作用域内的所有执行共享同一期限 (与已有期限取较早者)
+     * @note 可用于对单个回调施加 CPU 预算，需在持有 Locker 的线程上使用
+     */
+    class DeadlineScope final {
+        JsEngine* engine_;
+        int64_t   prevDeadline_;
+
+    public:
+        QJSPP_DISABLE_COPY_MOVE(DeadlineScope);
+        QJSPP_DISABLE_NEW();
+
+        explicit DeadlineScope(JsEngine& engine, std::chrono::milliseconds budget);
+        explicit DeadlineScope(JsEngine* engine, std::chrono::milliseconds budget);
+        ~DeadlineScope();
+    };
+
     size_t getMemoryUsage();
 
     TaskQueue* getTaskQueue() const;
 
+    /**
+     * 获取 JavaScript 采样 CPU 性能分析器
+     */
+    [[nodiscard]] CpuProfiler& getCpuProfiler() const;
+
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+    /**
+     * 获取原生绑定调用性能分析器
+     * @note 仅在定义 QJSPP_ENABLE_BINDING_PROFILER 时可用
+     */
+    [[nodiscard]] BindingProfiler& getBindingProfiler() const;
+#endif
+
     void setData(std::shared_ptr<void> data);
 
     template <typename T>
@@ -79,9 +192,11 @@ public:
     /**
      * 注册一个原生类
      * @param def 类定义
+     * @param lazy 延迟构建，全局对象上仅安装一个访问器，首次访问、派生类构建或 C++ 创建实例时才构建构造函数与原型
      * @note 默认此函数会注册的 native 类挂载到 JavaScript 的全局对象(globalThis)上
+     * @note 延迟注册的类在构建前 isInstanceOf 始终返回 false (此时不可能存在其实例)
      */
-    bool registerClass(bind::meta::ClassDefine const& def);
+    bool registerClass(bind::meta::ClassDefine const& def, bool lazy = false);
 
     /**
      * 注册一个原生模块
@@ -103,6 +218,7 @@ public:
 
     /**
      * 创建一个新的 JavaScript 类实例
+     * @note 直接以注册时缓存的原型创建包装对象，不调用 JS 构造函数
      */
     Object newInstance(bind::meta::ClassDefine const& def, std::unique_ptr<bind::JsManagedResource>&& managedResource);
 
@@ -128,6 +244,15 @@ public:
     template <typename T>
     Object newInstanceOfView(bind::meta::ClassDefine const& def, T* instance, Object ownerJs);
 
+    /**
+     * 创建(或复用)类成员的 JavaScript 实例 (instancePropertyRef)
+     * @param slot 缓存槽位，每个属性唯一 (instancePropertyRef 由 adapter::nextMemberSlot 分配)
+     * @note 包装对象缓存于 ownerJs 的内部槽位，原生指针不变时重复访问返回同一对象，owner 回收时一并失效
+     * @note 缓存对象与 owner 通过 Symbol 属性互相引用，由 GC 的循环回收一同释放
+     * @note 这两个 Symbol 属性不可枚举、不可写、不可删除，但脚本仍可通过 Object.getOwnPropertySymbols 看到
+     */
+    Object newInstanceOfMember(bind::meta::ClassDefine const& def, void* member, Object const& ownerJs, uint32_t slot);
+
     /**
      * 创建一个新的 JavaScript 类实例
      * @note qjspp 接管实例的生命周期，GC 时自动销毁
@@ -160,20 +285,70 @@ public:
 private:
     void setObjectToStringTag(Object& obj, std::string_view tag) const;
 
+    // 批量执行延迟的原生析构 (GC 后、Locker 释放时)
+    void drainFinalizeQueue();
+
+    // 释放其它线程通过 releaseValue 入队的 JS 值
+    void drainReleaseList();
+
+    // 等待其它线程中进行中的 releaseValue 调用结束 (析构)
+    void waitReleasers() const;
+
+    // QuickJS 中断回调 (JS_SetInterruptHandler)，返回非 0 时中断执行
+    static int interruptHandler(JSRuntime* rt, void* opaque);
+
+    enum class InterruptReason { None, Terminate, Deadline };
+
     ::JSRuntime* runtime_{nullptr};
     ::JSContext* context_{nullptr};
 
-    int              pauseGcCount_ = 0;      // 暂停GC计数
-    bool             isDestroying_{false};   // 正在销毁
-    std::atomic_bool pumpScheduled_ = false; // 任务队列是否已经调度
+    int              pauseGcCount_ = 0;             // 暂停GC计数
+    std::atomic_bool isDestroying_{false};          // 正在销毁，任意线程可读
+    std::atomic_bool pumpScheduled_        = false; // 任务队列是否已经调度
+    std::atomic_int  latencyCriticalCount_ = 0;     // 延迟敏感区间计数
+
+    // idle gc
+    bool                                  idleGcEnabled_{false};
+    IdleGcOptions                         idleGcOptions_{};
+    size_t                                idleGcBaseline_{0};  // 上次 GC 后的内存占用
+    size_t                                autoGcThreshold_{0}; // 被接管前的 QuickJS GC 阈值
+    std::chrono::steady_clock::time_point idleGcLastCheck_{};
+
+    // execution limits
+    int                       executionDepth_{0};                      // 执行入口嵌套深度
+    std::chrono::milliseconds executionTimeout_{0};                    // 单次执行时间上限
+    int64_t                   deadline_{0};                            // steady_clock 纳秒时间戳，0 表示无期限
+    std::atomic_bool          terminateRequested_{false};              // terminate() 请求
+    InterruptReason           interruptReason_{InterruptReason::None}; // 最近一次中断的原因
 
     std::shared_ptr<void>        userData_{nullptr};   // 用户数据
+    std::shared_ptr<void>        aliveToken_{nullptr}; // 存活令牌
     std::unique_ptr<TaskQueue>   queue_{nullptr};      // 任务队列
     mutable std::recursive_mutex mutex_;               // 线程安全互斥量
     JSAtom                       lengthAtom_ = {};     // for Array
     JSAtom                       toStringTagSymbol_{}; // for class、enum...
+    JSAtom                       memberCacheSymbol_{}; // newInstanceOfMember, owner -> 成员包装对象表
+    JSAtom                       memberOwnerSymbol_{}; // newInstanceOfMember, 成员包装对象 -> owner
+
+    // releaseValue 的无锁释放队列 (Treiber stack)，由 Locker 获取时清空
+    struct ReleaseNode {
+        JSValue      value_;
+        ReleaseNode* next_;
+    };
+    std::atomic<ReleaseNode*> releaseList_{nullptr};
+    std::atomic_uint32_t      releasers_{0};         // 其它线程中进行中的 releaseValue 调用数
+    std::atomic_bool          releaseClosed_{false}; // 析构时最后一次清空后，不再入队
+
+    std::vector<std::vector<JSAtom>> atomCache_; // getCachedAtoms 按槽位缓存的 atom
 
-    std::unique_ptr<detail::BindRegistry> bindRegistry_{nullptr};
+    std::unique_ptr<detail::BindRegistry>  bindRegistry_{nullptr};
+    std::unique_ptr<CpuProfiler>           cpuProfiler_{nullptr};
+    std::unique_ptr<detail::ResourcePool>  resourcePool_{nullptr};  // JsManagedResource 分配池，运行时释放后销毁
+    std::unique_ptr<detail::FinalizeQueue> finalizeQueue_{nullptr}; // 实例类的延迟析构队列
+
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+    std::unique_ptr<BindingProfiler> profiler_{nullptr};
+#endif
 
     // helpers
     JSClassID kPointerClassId{JS_INVALID_CLASS_ID};
@@ -189,15 +364,28 @@ private:
         ~PauseGc();
     };
 
+    // 执行入口，最外层负责设置单次执行期限并在退出时清理中断状态
+    class ExecutionScope final {
+        JsEngine* engine_;
+        int64_t   prevDeadline_;
+        QJSPP_DISABLE_COPY_MOVE(ExecutionScope);
+
+    public:
+        explicit ExecutionScope(JsEngine* engine);
+        ~ExecutionScope();
+    };
+
     friend class Locker;
     friend class Unlocker;
     friend class Array; // 访问 lengthAtom_
     friend class Function;
+    friend class JsException; // 读取 interruptReason_
     friend class PauseGc;
     friend detail::ModuleLoader;
     friend detail::FunctionFactory;
     friend detail::BindRegistry;
     friend bind::meta::ModuleDefine;
+    friend bind::JsManagedResource; // 访问 resourcePool_
 };
 
 
@@ -36,13 +36,12 @@ Object JsEngine::newInstanceOfView(bind::meta::ClassDefine const& def, T* instan
         explicit Control(Object ownerJs, void* instance) : ownerJsInst(std::move(ownerJs)), nativeInst(instance) {}
         ~Control() { ownerJsInst.reset(); }
     };
-    auto control = new Control{ownerJs, instance};
-
-    auto wrap = bind::JsManagedResource::make(
-        control,
+    auto wrap = bind::JsManagedResource::makeInline<Control>(
         [](void* res) -> void* { return static_cast<Control*>(res)->nativeInst; },
-        [](void* res) -> void { delete static_cast<Control*>(res); }
+        std::move(ownerJs),
+        instance
     );
+    wrap->engineBound_ = true;
     return newInstance(def, std::move(wrap));
 }
 
@@ -53,35 +52,28 @@ Object JsEngine::newInstanceOfUnique(bind::meta::ClassDefine const& def, std::un
 
 template <typename T>
 Object JsEngine::newInstanceOfShared(bind::meta::ClassDefine const& def, std::shared_ptr<T>&& instance) {
-    struct Control {
-        std::shared_ptr<T> instance;
-        explicit Control(std::shared_ptr<T>&& instance) : instance(std::move(instance)) {}
-    };
-    auto control = new Control{std::move(instance)};
-    auto wrap    = bind::JsManagedResource::make(
-        control,
-        [](void* res) -> void* { return static_cast<Control*>(res)->instance.get(); },
-        [](void* res) -> void { delete static_cast<Control*>(res); }
+    using Control = std::shared_ptr<T>;
+    auto wrap     = bind::JsManagedResource::makeInline<Control>(
+        [](void* res) -> void* { return static_cast<Control*>(res)->get(); },
+        std::move(instance)
     );
+    wrap->ownership_ = bind::JsManagedResource::Ownership::Shared;
     return newInstance(def, std::move(wrap));
 }
 
 template <typename T>
 Object JsEngine::newInstanceOfWeak(bind::meta::ClassDefine const& def, std::weak_ptr<T>&& instance) {
-    struct Control {
-        std::weak_ptr<T> instance;
-        explicit Control(std::weak_ptr<T>&& instance) : instance(std::move(instance)) {}
-    };
-    auto control = new Control{std::move(instance)};
-    auto wrap    = bind::JsManagedResource::make(
-        control,
+    using Control = std::weak_ptr<T>;
+    auto wrap     = bind::JsManagedResource::makeInlinePinned<Control>(
         [](void* res) -> void* {
-            // TODO: 临时 shared_ptr 裸指针不安全，需要持久化或在 wrapper 后清理
-            return static_cast<Control*>(res)->instance.lock().get();
+            // 未固定时的访问 (如 getNativeInstanceOf)，仅保证取得指针时实例存活
+            return static_cast<Control*>(res)->lock().get();
         },
-        [](void* res) -> void { delete static_cast<Control*>(res); }
+        // 绑定的方法 / 属性调用期间以 Pin 持有强引用，整个调用只 lock() 一次
+        [](void* res) -> std::shared_ptr<void> { return static_cast<Control*>(res)->lock(); },
+        std::move(instance)
     );
-    return newInstance(def, wrap);
+    return newInstance(def, std::move(wrap));
 }
 
 template <typename T>
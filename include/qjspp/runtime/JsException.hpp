@@ -1,8 +1,10 @@
 #pragma once
 #include "qjspp/Forward.hpp"
+#include "qjspp/runtime/StackFrame.hpp"
 #include <exception>
 #include <memory>
 #include <string>
+#include <vector>
 
 
 namespace qjspp {
@@ -24,7 +26,20 @@ public:
         ReferenceError,
         SyntaxError,
         TypeError,
-        InternalError // QuickJs extension
+        InternalError, // QuickJs extension
+        Terminated     // 执行被中断 (JsEngine::terminate / 超出执行期限)，JavaScript 侧无法捕获
+    };
+
+    /**
+     * 异常的结构化快照，仅包含普通字符串与数值
+     * 可在不持有 Locker 的情况下拷贝、跨线程传递 (例如交给日志线程)
+     */
+    struct ErrorInfo {
+        Type                    type_{Type::Any};
+        std::string             name_;    // Error.name，C++ 侧构造的异常由 type 推导
+        std::string             message_; // Error.message，非标准异常为其字符串形式
+        std::string             stack_;   // Error.stack 原文
+        std::vector<StackFrame> frames_;  // 由 stack 解析的调用栈
     };
 
     explicit JsException(std::string message, Type type = Type::ReferenceError);
@@ -46,14 +61,31 @@ public:
 
     [[nodiscard]] std::string stacktrace() const noexcept;
 
+    /**
+     * 获取结构化的异常信息，首次调用时读取 name / message / stack 并缓存，之后不再访问引擎
+     * message() / what() / stacktrace() 同样由此快照提供
+     * C++ 侧构造的异常在 exception() / rethrowToEngine() 创建异常对象时会就地刷新快照，以补全调用栈
+     * @note 首次调用需要持有 Locker；返回的 ErrorInfo 拷贝后可在任意线程使用
+     */
+    [[nodiscard]] ErrorInfo const& errorInfo() const;
+
     [[nodiscard]] JSValue rethrowToEngine() const;
 
 public:
     static void check(::JSValue val);
     static void check(int code, const char* msg = "Unknown error");
 
+    /**
+     * 绑定错误的快速路径: 以静态消息直接向引擎抛出异常 (JS_ThrowTypeError 等)
+     * 不构造 JsException、不抛出 C++ 异常，返回的 JS_EXCEPTION 哨兵值可直接作为绑定回调的返回值
+     * @param message 静态字符串，原样作为 message (不进行格式化)
+     * @note 需要持有 Locker，常用于参数校验等由不可信脚本频繁触发的错误
+     */
+    [[nodiscard]] static Value raise(Type type, char const* message) noexcept;
+
 private:
     void extractMessage() const noexcept;
+    void captureErrorInfo() const;
 
     struct ExceptionContext;
     std::shared_ptr<ExceptionContext> data_{nullptr};
@@ -32,7 +32,8 @@ private:
     JsEngine* engine_{nullptr};
     Locker*   prev_{nullptr};
 
-    static thread_local Locker* gCurrentScope_;
+    static thread_local Locker*      gCurrentScope_;
+    static thread_local ::JSRuntime* gCurrentRuntime_; // 缓存 gCurrentScope_->engine_->runtime_，用于引用计数快速路径
     friend class Unlocker;
 };
 
@@ -0,0 +1,26 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace qjspp {
+
+
+// JavaScript 调用栈帧，由 Error.stack 解析得到
+struct StackFrame {
+    std::string functionName_;
+    std::string url_;           // 脚本文件名，原生帧为空
+    int         line_{-1};      // 1-based, -1 表示未知
+    int         column_{-1};    // 1-based, -1 表示未知
+    bool        native_{false}; // 原生(C/C++)函数帧
+};
+
+/**
+ * 解析 QuickJS 的 Error.stack 字符串
+ * @note 纯字符串处理，不需要 Locker
+ */
+[[nodiscard]] std::vector<StackFrame> parseStackTrace(std::string_view stack);
+
+
+} // namespace qjspp
@@ -38,12 +38,17 @@ public:
     // 关闭队列
     void shutdown(bool wait = false);
 
+    // 设置空闲回调，在单次循环没有到期任务时调用 (传入 nullptr 取消)
+    void setIdleHandler(TaskCallback callback, void* data = nullptr);
+
 private:
     std::priority_queue<Task, std::vector<Task>, std::greater<>> tasks_;
     std::mutex                                                   mutex_;
     std::condition_variable                                      cv_;
-    std::atomic<bool>                                            shutdown_;   // 关闭队列
-    std::atomic<bool>                                            awaitTasks_; // 等待任务完成
+    std::atomic<bool>                                            shutdown_;              // 关闭队列
+    std::atomic<bool>                                            awaitTasks_;            // 等待任务完成
+    TaskCallback                                                 idleCallback_{nullptr}; // 空闲回调
+    void*                                                        idleData_{nullptr};     // 空闲回调数据
 };
 
 
@@ -1,9 +1,11 @@
 #pragma once
+#include <memory>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "qjspp/Global.hpp"
+#include "qjspp/bind/JsManagedResource.hpp"
 #include "qjspp/bind/meta/ClassDefine.hpp"
 #include "qjspp/bind/meta/EnumDefine.hpp"
 #include "qjspp/bind/meta/MemberDefine.hpp"
@@ -25,6 +27,7 @@ struct BindRegistry final {
     std::unordered_map<bind::meta::EnumDefine const*, Object>                       enums_;
     std::unordered_map<bind::meta::ClassDefine const*, Object>                      staticClasses_;
     std::unordered_map<bind::meta::ClassDefine const*, std::pair<JSValue, JSValue>> instanceClasses_; // ctor, prototype
+    std::unordered_map<bind::meta::ClassDefine const*, bool>                        lazyClasses_;     // not built yet
     std::unordered_map<std::string, bind::meta::ModuleDefine const*>                lazyModules_;     // loaded lazily
     std::unordered_map<JSModuleDef*, bind::meta::ModuleDefine const*>               loadedModules_;
 
@@ -40,11 +43,14 @@ struct BindRegistry final {
     };
     std::unordered_map<JSModuleDef*, ModuleExportCache> moduleExports_;
 
+    // 身份缓存：原生指针 -> 包装对象，不持有引用计数，包装对象 finalizer 中移除
+    std::unordered_map<bind::meta::ClassDefine const*, std::unordered_map<void*, JSValue>> identityCache_;
+
     explicit BindRegistry(JsEngine& engine);
     ~BindRegistry();
 
     bool tryRegister(bind::meta::EnumDefine const& enumDef);
-    bool tryRegister(bind::meta::ClassDefine const& classDef);
+    bool tryRegister(bind::meta::ClassDefine const& classDef, bool lazy);
     bool tryRegister(bind::meta::ModuleDefine const& moduleDef);
 
     Object _buildEnum(bind::meta::EnumDefine const& enumDef) const;
@@ -55,10 +61,31 @@ struct BindRegistry final {
     Value    _registerClass(bind::meta::ClassDefine const& def);
     Function _buildClassConstructor(bind::meta::ClassDefine const& def) const;
     Object   _buildClassPrototype(bind::meta::ClassDefine const& def) const;
-    void     _buildClassStatic(bind::meta::StaticMemberDefine const& def, Object& ctor) const;
+    void     _buildClassStatic(bind::meta::ClassDefine const& def, Object& ctor) const;
+    void     _buildMemberTable(bind::meta::ClassDefine const& def, Object& target, bool instance) const;
+
+    // 实例成员跳板：解析 this 对应的原生实例并在调用期间固定，随后调用 invoke(instance)
+    template <typename Invoke>
+    static Value _invokeInstanceMember(Arguments const& args, void* define, Invoke&& invoke);
+
+    // 延迟注册：全局对象上仅安装访问器，首次访问或 C++ 创建实例时才构建类
+    void  _installLazyClass(bind::meta::ClassDefine const& def);
+    Value _materializeClass(bind::meta::ClassDefine const& def);
 
     void _buildModuleExports(bind::meta::ModuleDefine const& def, JSModuleDef* m);
 
+    // C++ 侧创建实例包装对象 (JsEngine::newInstance)
+    Object newInstance(bind::meta::ClassDefine const& def, std::unique_ptr<bind::JsManagedResource>&& managedResource);
+
+    void _cacheIdentity(bind::meta::ClassDefine const& def, bind::JsManagedResource* managed, JSValue obj);
+
+    // 身份缓存命中时处理新传入的持有型资源：不持有实例的包装对象接管所有权，重复所有权时抛出 logic_error
+    void _adoptResource(
+        bind::meta::ClassDefine const&             def,
+        JSValue                                    obj,
+        std::unique_ptr<bind::JsManagedResource>&& managedResource
+    );
+
     // quickjs callbacks
     static void kInstanceClassFinalizer(JSRuntime*, JSValue val);
 };
@@ -0,0 +1,70 @@
+#pragma once
+#include "qjspp/Global.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace qjspp::bind {
+struct JsManagedResource;
+}
+
+namespace qjspp::detail {
+
+
+/**
+ * 延迟析构队列
+ * 实例类的 GC finalizer 只将托管资源加入队列，原生析构在 GC 结束后 (JsEngine::gc、Locker 释放) 批量执行
+ * 积压过多时 (full) 也会在中断轮询等安全点析构，避免长时间持有 Locker 时无限增长
+ * 声明了 threadSafeDestructible 的类在后台线程析构，析构完成的资源交回引擎线程归还内存
+ * @note 除后台线程外，所有接口都需要在持有所属引擎 Locker 的线程上调用
+ */
+class FinalizeQueue final {
+public:
+    FinalizeQueue() = default;
+    ~FinalizeQueue();
+    QJSPP_DISABLE_COPY_MOVE(FinalizeQueue);
+
+    void push(bind::JsManagedResource* managed);
+
+    static constexpr size_t kBatchSize = 1024;
+
+    [[nodiscard]] inline bool empty() const { return pending_.empty() && background_.empty() && !hasFinished_; }
+
+    // 积压达到 kBatchSize，应在下一个安全点 (中断轮询、C++ 创建实例) 析构
+    [[nodiscard]] inline bool full() const { return pending_.size() + background_.size() >= kBatchSize; }
+
+    /**
+     * 析构队列中的资源，析构过程中新加入的资源在同一次调用中一并处理
+     * @note 重入时 (析构函数中再次触发) 直接返回
+     */
+    void drain();
+
+    /**
+     * 等待后台线程结束，并在当前线程析构所有剩余资源 (JsEngine 析构)
+     */
+    void shutdown();
+
+private:
+    void workerLoop();
+    void destroy(std::vector<bind::JsManagedResource*>& batch);
+
+    std::vector<bind::JsManagedResource*> pending_;    // 引擎线程析构
+    std::vector<bind::JsManagedResource*> background_; // 待交给后台线程
+    bool                                  draining_{false};
+
+    std::thread                           worker_;
+    std::mutex                            mutex_;
+    std::condition_variable               cv_;
+    bool                                  stopping_{false};
+    std::vector<bind::JsManagedResource*> inbox_;              // 后台线程待析构
+    std::vector<bind::JsManagedResource*> finished_;           // 实例已析构，待归还内存
+    std::atomic_bool                      hasFinished_{false}; // finished_ 非空
+};
+
+
+} // namespace qjspp::detail
@@ -1,7 +1,10 @@
 #pragma once
 #include "qjspp/Forward.hpp"
+#include "qjspp/runtime/BindingProfiler.hpp"
 #include "qjspp/types/Function.hpp"
 
+#include <string_view>
+
 namespace qjspp {
 class JsEngine;
 }
@@ -14,7 +17,24 @@ struct FunctionFactory {
 
     using RawFunctionData = Value (*)(Arguments const&, void*, void*);
 
-    [[nodiscard]] static Function create(JsEngine& engine, void* data1, void* data2, RawFunctionData rawFn);
+    /**
+     * @param kind/scope/member 绑定信息，用于设置函数 name 属性(出现在 Error.stack 与 CpuProfiler 的原生帧中)
+     *                          以及 BindingProfiler 统计
+     */
+    [[nodiscard]] static Function create(
+        JsEngine&        engine,
+        void*            data1,
+        void*            data2,
+        RawFunctionData  rawFn,
+        BindingKind      kind   = BindingKind::Function,
+        std::string_view scope  = {},
+        std::string_view member = {}
+    );
+
+    /**
+     * 设置函数的 name 属性 (name 为空时不做任何事)
+     */
+    static void setName(JsEngine& engine, JSValue fn, std::string_view name);
 
 private:
     static JSValue newOpaque(JsEngine& engine, void* data);
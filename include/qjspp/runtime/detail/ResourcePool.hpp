@@ -0,0 +1,52 @@
+#pragma once
+#include "qjspp/Global.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+
+namespace qjspp::detail {
+
+
+/**
+ * 定长块分配器 (slab)，按块批量申请内存并以空闲链表复用
+ * 用于 JsManagedResource 等随包装对象频繁创建、在 GC finalizer 中释放的小对象
+ * @note 非线程安全，需在持有所属引擎 Locker 的线程上使用
+ * @note 析构时若仍有未归还的块则放弃释放整块内存，避免悬垂
+ */
+class ResourcePool final {
+public:
+    explicit ResourcePool(size_t blockSize, size_t blocksPerChunk = 256);
+    ~ResourcePool();
+    QJSPP_DISABLE_COPY_MOVE(ResourcePool);
+
+    [[nodiscard]] void* allocate();
+
+    void deallocate(void* block) noexcept;
+
+    [[nodiscard]] size_t blockSize() const;
+
+    [[nodiscard]] size_t inUse() const; // 未归还的块数
+
+    [[nodiscard]] size_t capacity() const; // 已申请的块数
+
+private:
+    struct FreeNode {
+        FreeNode* next_;
+    };
+
+    void grow();
+
+    size_t                                    blockSize_;
+    size_t                                    blocksPerChunk_;
+    FreeNode*                                 freeList_{nullptr};
+    size_t                                    inUse_{0};
+    std::vector<std::unique_ptr<std::byte[]>> chunks_;
+};
+
+// 创建 JsManagedResource 使用的资源池 (块大小包含来源记录头)
+[[nodiscard]] std::unique_ptr<ResourcePool> newManagedResourcePool();
+
+
+} // namespace qjspp::detail
@@ -41,10 +41,17 @@ public:
     // Obtain internal resource management wrapper.
     // This function is only used internally.
     // note: This resource is only valid during instance class calls (method, property).
+    // note: weak_ptr backed instances are pinned for the whole call, get() returns the pinned pointer.
     [[nodiscard]] bool                     hasJsManagedResource() const;
     [[nodiscard]] bind::JsManagedResource* getJsManagedResource() const;
 
     Value operator[](size_t index) const;
+
+    /**
+     * 借用第 index 个参数，不增加引用计数 (越界时为 undefined)
+     * @note 仅在本次调用期间有效
+     */
+    [[nodiscard]] ValueRef at(size_t index) const;
 };
 
 } // namespace qjspp
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "qjspp/concepts/ScriptConcepts.hpp"
 
 #include <span>
+#include <string_view>
 
 namespace qjspp {
 
@@ -13,7 +14,10 @@ class Function final {
 
 public:
     QJSPP_DEFINE_VALUE_COMMON(Function);
-    explicit Function(FunctionCallback callback);
+    /**
+     * @param name 函数名，非空时设置为 Js 函数的 name 属性，同时作为 BindingProfiler 的统计键
+     */
+    explicit Function(FunctionCallback callback, std::string_view name = {});
 
     [[nodiscard]] static Function newFunction(FunctionCallback&& callback);
 
@@ -29,6 +33,17 @@ public:
         requires(concepts::JsValueType<std::remove_cvref_t<Args>> && ...)
     Value call(Value const& thiz, Args&&... args) const;
 
+    /**
+     * 调用函数，C++ 参数经 TypeConverter 直接转换到栈上的 JSValue 缓冲区，返回值转换为 R
+     * @tparam R 返回类型，Value 时不做转换，void 时丢弃返回值
+     * @note 需要包含 qjspp/bind/TypeConverter.hpp
+     */
+    template <typename R = Value, typename... Args>
+    R invoke(Args&&... args) const;
+
+    template <typename R = Value, typename... Args>
+    R invokeWithThis(Value const& thiz, Args&&... args) const;
+
     Value callAsConstructor(std::vector<Value> const& args = {}) const;
 
     bool isConstructor() const;
@@ -4,6 +4,15 @@
 
 namespace qjspp {
 
+namespace bind {
+template <typename T>
+[[nodiscard]] inline Value ConvertToJs(T&& value);
+
+template <typename T>
+[[nodiscard]] inline decltype(auto) ConvertToCpp(Value const& value);
+} // namespace bind
+
+
 template <typename... Args>
     requires(concepts::JsValueType<std::remove_cvref_t<Args>> && ...)
 Value Function::call(Value const& thiz, Args&&... args) const {
@@ -11,5 +20,36 @@ Value Function::call(Value const& thiz, Args&&... args) const {
     return call(thiz, std::span<Value const>(argsArr));
 }
 
+template <typename R, typename... Args>
+R Function::invoke(Args&&... args) const {
+    return invokeWithThis<R>(Value{}, std::forward<Args>(args)...);
+}
+
+template <typename R, typename... Args>
+R Function::invokeWithThis(Value const& thiz, Args&&... args) const {
+    // 转换后的参数所有权转移到缓冲区，调用结束(或转换中途抛出异常)后统一释放
+    struct ArgvBuffer {
+        JSValue argv[sizeof...(Args) + 1]{};
+        int     argc{0};
+
+        ~ArgvBuffer() {
+            for (int i = 0; i < argc; ++i) {
+                detail::freeValue(argv[i]);
+            }
+        }
+    } buffer;
+    ((buffer.argv[buffer.argc++] = Value::release(bind::ConvertToJs(std::forward<Args>(args)))), ...);
+
+    static_assert(sizeof(Value) == sizeof(JSValue), "Value and JSValue must have the same size");
+    auto ret = callImpl(thiz, buffer.argc, reinterpret_cast<Value const*>(buffer.argv));
+    if constexpr (std::is_void_v<R>) {
+        return;
+    } else if constexpr (std::is_same_v<R, Value>) {
+        return ret;
+    } else {
+        return bind::ConvertToCpp<R>(ret);
+    }
+}
+
 
 } // namespace qjspp
\ No newline at end of file
@@ -0,0 +1,143 @@
+#pragma once
+#include "Function.hpp"
+#include "Value.hpp"
+#include "qjspp/runtime/JsEngine.hpp"
+#include "qjspp/runtime/JsException.hpp"
+#include "qjspp/runtime/Locker.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace qjspp {
+
+template <typename Signature>
+class JsCallback;
+
+/**
+ * @class JsCallback
+ * @brief 持久化的 JS 回调句柄
+ *
+ * @details
+ * 持有函数与可选的 this (receiver)，构造时完成类型检查，调用时不再重复解析。
+ * 当前线程已持有目标引擎的 Locker 时直接调用，否则临时创建 Locker；析构不获取 Locker，见 reset()。
+ * 参数经 Function::invokeWithThis 直接转换到栈上缓冲区，调用成功时不产生任何 C++ 异常。
+ *
+ * @note 通过 isAlive() 可在任意线程检查引擎是否已销毁，引擎销毁后调用将抛出 JsException
+ * @note 可直接用作绑定函数的参数类型 (TypeConverter)，也可隐式转换为 std::function
+ */
+template <typename R, typename... Args>
+class JsCallback<R(Args...)> final {
+    JsEngine*           engine_{nullptr};
+    std::weak_ptr<void> alive_{}; // JsEngine::getAliveToken()
+    Function            fn_{JS_UNDEFINED};
+    Value               thiz_{};
+
+    // 已在目标引擎作用域内时跳过 Locker
+    template <typename Fn>
+    decltype(auto) withScope(Fn&& fn) const {
+        if (Locker::currentEngine() == engine_) {
+            return fn();
+        }
+        Locker lock{engine_};
+        return fn();
+    }
+
+public:
+    JsCallback() = default;
+
+    /**
+     * @param fn 回调函数
+     * @param thiz 调用时使用的 this，默认为 undefined
+     * @note 需要持有 Locker
+     */
+    explicit JsCallback(Function fn, Value thiz = {})
+    : JsCallback(&Locker::currentEngineChecked(), std::move(fn), std::move(thiz)) {}
+
+    explicit JsCallback(JsEngine* engine, Function fn, Value thiz = {})
+    : engine_(engine),
+      alive_(engine->getAliveToken()),
+      fn_(std::move(fn)),
+      thiz_(std::move(thiz)) {}
+
+    JsCallback(JsCallback&& other) noexcept
+    : engine_(std::exchange(other.engine_, nullptr)),
+      alive_(std::move(other.alive_)),
+      fn_(std::move(other.fn_)),
+      thiz_(std::move(other.thiz_)) {}
+
+    JsCallback(JsCallback const& copy) : engine_(copy.engine_), alive_(copy.alive_) {
+        if (copy.isValid()) {
+            withScope([&] {
+                fn_   = copy.fn_;
+                thiz_ = copy.thiz_;
+            });
+        }
+    }
+
+    JsCallback& operator=(JsCallback&& other) noexcept {
+        if (this != &other) {
+            reset();
+            engine_ = std::exchange(other.engine_, nullptr);
+            alive_  = std::move(other.alive_);
+            fn_     = std::move(other.fn_);
+            thiz_   = std::move(other.thiz_);
+        }
+        return *this;
+    }
+
+    JsCallback& operator=(JsCallback const& copy) {
+        if (this != &copy) {
+            *this = JsCallback{copy};
+        }
+        return *this;
+    }
+
+    ~JsCallback() { reset(); }
+
+    /**
+     * 释放持有的函数与 this
+     * @note 在其它线程释放时不等待引擎锁，经 JsEngine::releaseValue 入队延迟释放
+     * @note 引擎析构期间(例如随原生实例一同被 GC)仍正常释放，运行时已释放后仅丢弃引用
+     */
+    void reset() {
+        if (!isValid()) return;
+        if (auto token = alive_.lock()) { // 持有令牌期间引擎对象不会被释放
+            engine_->releaseValue(Value::release(std::move(fn_)));
+            engine_->releaseValue(Value::release(std::move(thiz_)));
+        } else {
+            (void)Value::release(std::move(fn_));
+            (void)Value::release(std::move(thiz_));
+        }
+        engine_ = nullptr;
+        alive_.reset();
+    }
+
+    [[nodiscard]] bool isValid() const { return engine_ != nullptr; }
+
+    /**
+     * 引擎是否仍然存活，可在任意线程调用
+     */
+    [[nodiscard]] bool isAlive() const {
+        if (!engine_) return false;
+        auto token = alive_.lock(); // 持有令牌期间引擎对象不会被释放，可安全读取 isDestroying
+        return token && !engine_->isDestroying();
+    }
+
+    [[nodiscard]] explicit operator bool() const { return isAlive(); }
+
+    [[nodiscard]] JsEngine* engine() const { return engine_; }
+
+    [[nodiscard]] Function const& function() const { return fn_; }
+
+    [[nodiscard]] Value const& receiver() const { return thiz_; }
+
+    R operator()(Args... args) const {
+        if (!isAlive()) [[unlikely]] {
+            throw JsException{JsException::Type::InternalError, "callback engine has been destroyed"};
+        }
+        return withScope([&]() -> R { return fn_.template invokeWithThis<R>(thiz_, std::forward<Args>(args)...); });
+    }
+};
+
+
+} // namespace qjspp
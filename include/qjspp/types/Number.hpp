@@ -3,6 +3,9 @@
 
 #include "qjspp/concepts/BasicConcepts.hpp"
 
+#include <type_traits>
+#include <utility>
+
 namespace qjspp {
 
 class Number final {
@@ -18,8 +21,16 @@ public:
     [[nodiscard]] int     getInt32() const;
     [[nodiscard]] int64_t getInt64() const;
 
+    /**
+     * 整数在 int32 范围内时创建 JS_TAG_INT 值，其余按 double 创建
+     */
     template <concepts::NumberLike T>
     [[nodiscard]] static Number newNumber(T num) {
+        if constexpr (std::is_integral_v<T>) {
+            if (std::in_range<int>(+num)) { // 一元 + 将 bool / 字符类型提升为 std::in_range 接受的标准整数类型
+                return Number{static_cast<int>(num)};
+            }
+        }
         return Number{static_cast<double>(num)};
     }
 };
@@ -42,6 +42,17 @@ public:
 
     [[nodiscard]] std::vector<std::string> getOwnPropertyNamesAsString() const;
 
+    /**
+     * 遍历自身可枚举的字符串键属性 (与 Object.keys 相同)，按 atom 直接读取属性值
+     * @param fn void(std::string_view key, Value value)，key 仅在本次回调期间有效
+     * @param reserve void(size_t count)，遍历前以属性数量调用一次，可用于预留容器容量
+     */
+    template <typename Fn>
+    void forEachOwnProperty(Fn&& fn) const;
+
+    template <typename Fn, typename Reserve>
+    void forEachOwnProperty(Fn&& fn, Reserve&& reserve) const;
+
     [[nodiscard]] bool instanceOf(Value const& value) const;
 
     bool defineOwnProperty(String const& key, Value const& value, PropertyAttributes attr = PropertyAttributes::None);
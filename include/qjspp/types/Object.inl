@@ -1,7 +1,9 @@
 #pragma once
 #include "qjspp/types/Object.hpp"
+#include "qjspp/runtime/JsException.hpp"
 #include "qjspp/types/Value.hpp"
 
+#include <cstddef>
 #include <string_view>
 
 namespace qjspp {
@@ -28,4 +30,43 @@ void Object::remove(T const& key) {
 }
 
 
+template <typename Fn>
+void Object::forEachOwnProperty(Fn&& fn) const {
+    forEachOwnProperty(std::forward<Fn>(fn), [](size_t) {});
+}
+
+template <typename Fn, typename Reserve>
+void Object::forEachOwnProperty(Fn&& fn, Reserve&& reserve) const {
+    auto            ctx  = Locker::currentContextChecked();
+    JSPropertyEnum* ptab = nullptr;
+    uint32_t        len  = 0;
+    JsException::check(JS_GetOwnPropertyNames(ctx, &ptab, &len, val_, JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY));
+
+    struct PropertyEnumGuard {
+        JSContext*      ctx;
+        JSPropertyEnum* ptab;
+        uint32_t        len;
+        ~PropertyEnumGuard() { JS_FreePropertyEnum(ctx, ptab, len); }
+    } guard{ctx, ptab, len};
+
+    reserve(static_cast<size_t>(len));
+    for (uint32_t i = 0; i < len; ++i) {
+        auto value = JS_GetProperty(ctx, val_, ptab[i].atom);
+        JsException::check(value);
+        auto val = Value::move<Value>(value);
+
+        size_t keyLen = 0;
+        auto   key    = JS_AtomToCStringLen(ctx, &keyLen, ptab[i].atom);
+        JsException::check(key ? 0 : -1);
+        struct CStringGuard {
+            JSContext*  ctx;
+            char const* str;
+            ~CStringGuard() { JS_FreeCString(ctx, str); }
+        } keyGuard{ctx, key};
+
+        fn(std::string_view{key, keyLen}, std::move(val));
+    }
+}
+
+
 } // namespace qjspp
\ No newline at end of file
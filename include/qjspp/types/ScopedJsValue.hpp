@@ -11,7 +11,7 @@ class JsEngine;
  *
  * @details
  * 该类用于在 C++ 侧安全持有一个 JS 值。
- * 析构时会自动创建一个 Locker，以保证 JS 引擎上下文安全。
+ * 析构时通过 JsEngine::releaseValue 释放：持有 Locker 时立即释放，否则无锁入队，不阻塞当前线程。
  * 常用于延迟释放 Value 或在非 JS 调用栈中保持 JS 引用。
  *
  * @note 适合在非 JS 线程或跨作用域时安全持有 Value。
@@ -32,6 +32,9 @@ public:
     [[nodiscard]] bool isArray() const;
     [[nodiscard]] bool isFunction() const;
 
+    // JsException::raise 返回的异常哨兵值，引擎中已有待处理的异常
+    [[nodiscard]] bool isException() const;
+
     [[nodiscard]] Undefined asUndefined() const;
     [[nodiscard]] Null      asNull() const;
     [[nodiscard]] Boolean   asBoolean() const;
@@ -67,6 +70,16 @@ public:
         undefined.val_ = std::move(ty);
         return undefined;
     }
+
+    /**
+     * @note 交出所有权，内部不进行减少引用计数，返回的 JSValue 需要自行释放
+     */
+    template <concepts::JsValueType Ty>
+    [[nodiscard]] inline static JSValue release(Ty&& ty) {
+        auto val = ty.val_;
+        ty.val_  = JS_UNDEFINED;
+        return val;
+    }
 };
 
 
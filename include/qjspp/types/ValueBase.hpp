@@ -1,6 +1,7 @@
 #pragma once
 #include "qjspp/Forward.hpp"
 #include "qjspp/Global.hpp"
+#include "qjspp/runtime/Locker.hpp"
 
 namespace qjspp {
 
@@ -35,21 +36,35 @@ public:
     bool operator==(Value const& other) const
 
 
+namespace detail {
+
+/**
+ * 引用计数快速路径
+ * 原始类型 (int/bool/float64/null/undefined 等) 不持有引用计数，直接跳过；
+ * 其余类型使用运行时级别的 JS_DupValueRT/JS_FreeValueRT，无需查询当前 JSContext
+ */
+inline JSValue dupValue(JSValue value) {
+    return JS_VALUE_HAS_REF_COUNT(value) ? JS_DupValueRT(Locker::currentRuntimeChecked(), value) : value;
+}
+inline void freeValue(JSValue value) {
+    if (JS_VALUE_HAS_REF_COUNT(value)) {
+        JS_FreeValueRT(Locker::currentRuntimeChecked(), value);
+    }
+}
+
+} // namespace detail
+
+
 #define IMPL_QJSPP_DEFINE_VALUE_COMMON(ValueType)                                                                      \
-    ValueType::ValueType(JSValue value) : val_(JS_DupValue(Locker::currentContextChecked(), value)) {}                 \
-    ValueType::~ValueType() {                                                                                          \
-        if (isValid()) {                                                                                               \
-            JS_FreeValue(Locker::currentContextChecked(), val_);                                                       \
-        }                                                                                                              \
-    }                                                                                                                  \
+    ValueType::ValueType(JSValue value) : val_(detail::dupValue(value)) {}                                             \
+    ValueType::~ValueType() { detail::freeValue(val_); }                                                               \
                                                                                                                        \
-    ValueType::ValueType(ValueType const& copy) : val_(JS_DupValue(Locker::currentContextChecked(), copy.val_)) {}     \
+    ValueType::ValueType(ValueType const& copy) : val_(detail::dupValue(copy.val_)) {}                                 \
     ValueType& ValueType::operator=(ValueType const& copy) {                                                           \
         if (this != &copy) {                                                                                           \
-            if (isValid()) {                                                                                           \
-                JS_FreeValue(Locker::currentContextChecked(), val_);                                                   \
-            }                                                                                                          \
-            val_ = JS_DupValue(Locker::currentContextChecked(), copy.val_);                                            \
+            auto old = val_;                                                                                           \
+            val_     = detail::dupValue(copy.val_);                                                                    \
+            detail::freeValue(old);                                                                                    \
         }                                                                                                              \
         return *this;                                                                                                  \
     }                                                                                                                  \
@@ -57,9 +72,7 @@ public:
     ValueType::ValueType(ValueType&& move) noexcept : val_(move.val_) { move.val_ = JS_UNDEFINED; }                    \
     ValueType& ValueType::operator=(ValueType&& move) noexcept {                                                       \
         if (this != &move) {                                                                                           \
-            if (isValid()) {                                                                                           \
-                JS_FreeValue(Locker::currentContextChecked(), val_);                                                   \
-            }                                                                                                          \
+            detail::freeValue(val_);                                                                                   \
             val_      = move.val_;                                                                                     \
             move.val_ = JS_UNDEFINED;                                                                                  \
         }                                                                                                              \
@@ -69,10 +82,8 @@ public:
     bool ValueType::isValid() const { return !JS_IsUninitialized(val_) && !JS_IsUndefined(val_) && !JS_IsNull(val_); } \
                                                                                                                        \
     void ValueType::reset() {                                                                                          \
-        if (isValid()) {                                                                                               \
-            JS_FreeValue(Locker::currentContextChecked(), val_);                                                       \
-            val_ = JS_UNDEFINED;                                                                                       \
-        }                                                                                                              \
+        detail::freeValue(val_);                                                                                       \
+        val_ = JS_UNDEFINED;                                                                                           \
     }                                                                                                                  \
                                                                                                                        \
     String ValueType::toString() const {                                                                               \
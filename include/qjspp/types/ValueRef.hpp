@@ -0,0 +1,46 @@
+#pragma once
+#include "Value.hpp"
+
+namespace qjspp {
+
+
+/**
+ * 非持有的值引用，不增加也不减少引用计数
+ * @note 仅在被引用值存活期间有效 (例如 Arguments 在一次原生回调期间有效)，不要保存到回调之外
+ * @note 可隐式转换为 Value const&，因此接受 Value const& 的 TypeConverter 可直接使用，无需复制 Value
+ */
+class ValueRef final {
+    // 借用槽：真实的 Value 对象，但不持有引用计数，析构前交出所有权，因此既不增加也不减少引用计数
+    Value view_{};
+
+public:
+    QJSPP_DISABLE_NEW();
+
+    ValueRef() = default;
+    explicit ValueRef(JSValueConst value);
+    ValueRef(Value const& value); // NOLINT: 借用一个 Value
+
+    ValueRef(ValueRef const& other);
+    ValueRef& operator=(ValueRef const& other);
+
+    ~ValueRef();
+
+    /**
+     * 以 Value 视图访问被引用值 (不持有引用)
+     */
+    [[nodiscard]] Value const& value() const;
+
+    [[nodiscard]] Value const* operator->() const;
+
+    operator Value const&() const; // NOLINT
+
+    /**
+     * 创建持有引用的 Value (增加引用计数)，可保存到回调之外
+     */
+    [[nodiscard]] Value toValue() const;
+
+    [[nodiscard]] JSValueConst raw() const;
+};
+
+
+} // namespace qjspp
@@ -0,0 +1,59 @@
+#include "qjspp/bind/JsManagedResource.hpp"
+#include "qjspp/runtime/JsEngine.hpp"
+#include "qjspp/runtime/Locker.hpp"
+#include "qjspp/runtime/detail/ResourcePool.hpp"
+
+#include <cassert>
+#include <new>
+
+
+namespace qjspp {
+
+namespace {
+
+// 每个块前部记录来源资源池，nullptr 表示来自全局分配器
+constexpr size_t kHeaderSize = alignof(std::max_align_t);
+
+} // namespace
+
+
+namespace bind {
+
+
+void* JsManagedResource::operator new(std::size_t size) {
+    detail::ResourcePool* pool  = nullptr;
+    void*                 block = nullptr;
+    if (auto engine = Locker::currentEngine(); engine && engine->resourcePool_) {
+        pool = engine->resourcePool_.get();
+        assert(kHeaderSize + size <= pool->blockSize());
+        block = pool->allocate();
+    } else {
+        block = ::operator new(kHeaderSize + size);
+    }
+    *static_cast<detail::ResourcePool**>(block) = pool;
+    return static_cast<std::byte*>(block) + kHeaderSize;
+}
+
+void JsManagedResource::operator delete(void* ptr) noexcept {
+    if (!ptr) return;
+    auto block = static_cast<std::byte*>(ptr) - kHeaderSize;
+    if (auto pool = *reinterpret_cast<detail::ResourcePool**>(block)) {
+        pool->deallocate(block);
+    } else {
+        ::operator delete(block);
+    }
+}
+
+
+} // namespace bind
+
+
+namespace detail {
+
+std::unique_ptr<ResourcePool> newManagedResourcePool() {
+    return std::make_unique<ResourcePool>(kHeaderSize + sizeof(bind::JsManagedResource));
+}
+
+} // namespace detail
+
+} // namespace qjspp
@@ -93,6 +93,9 @@ void bind::meta::ModuleDefine::_performExports(JsEngine* engine, JSContext* ctx,
             }
         }
 
+        if (!ctor.isValid() && engine->bindRegistry_->lazyClasses_.contains(def)) {
+            ctor = engine->bindRegistry_->_materializeClass(*def); // 延迟注册的类在此构建
+        }
         if (!ctor.isValid()) {
             ctor = engine->bindRegistry_->_registerClass(*def); // 无缓存进行注册
         }
@@ -0,0 +1,185 @@
+#include "qjspp/runtime/BindingProfiler.hpp"
+
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+
+#include <algorithm>
+#include <format>
+#include <sstream>
+
+#include "runtime/detail/JsonWriter.hpp"
+
+
+namespace qjspp {
+
+namespace {
+
+std::string_view kindName(BindingKind kind) {
+    switch (kind) {
+    case BindingKind::Function:
+        return "function";
+    case BindingKind::Method:
+        return "method";
+    case BindingKind::Getter:
+        return "getter";
+    case BindingKind::Setter:
+        return "setter";
+    case BindingKind::Constructor:
+        return "constructor";
+    }
+    return "unknown";
+}
+
+} // namespace
+
+
+BindingProfiler::Duration BindingProfiler::Entry::totalTime() const {
+    if (sampledCalls_ == 0) return Duration{0};
+    if (sampledCalls_ == calls_) return sampledTime_;
+    return Duration{static_cast<Duration::rep>(
+        static_cast<double>(sampledTime_.count()) * static_cast<double>(calls_) / static_cast<double>(sampledCalls_)
+    )};
+}
+
+std::string BindingProfiler::Entry::name() const {
+    if (scope_.empty()) return member_;
+    return std::format("{}.{}", scope_, member_);
+}
+
+
+BindingProfiler::CallScope::CallScope(BindingProfiler& profiler, Entry* entry) {
+    if (!entry || !profiler.enabled_) return;
+    entry_ = entry;
+    entry_->calls_++;
+
+    if (profiler.sampleInterval_ <= 1 || ++profiler.sampleCounter_ >= profiler.sampleInterval_) {
+        profiler.sampleCounter_ = 0;
+        start_                  = Clock::now();
+    }
+}
+BindingProfiler::CallScope::~CallScope() {
+    if (!entry_ || start_ == Clock::time_point{}) return;
+    auto elapsed = std::chrono::duration_cast<Duration>(Clock::now() - start_);
+    entry_->sampledCalls_++;
+    entry_->sampledTime_ += elapsed;
+    entry_->maxTime_      = std::max(entry_->maxTime_, elapsed);
+}
+void BindingProfiler::CallScope::markException() {
+    if (entry_) entry_->exceptions_++;
+}
+
+
+void BindingProfiler::setEnabled(bool enabled) { enabled_ = enabled; }
+
+bool BindingProfiler::isEnabled() const { return enabled_; }
+
+void BindingProfiler::setSampleInterval(uint32_t interval) {
+    sampleInterval_ = interval;
+    sampleCounter_  = 0;
+}
+
+void BindingProfiler::reset() {
+    for (auto& [key, entry] : entries_) {
+        entry.calls_        = 0;
+        entry.exceptions_   = 0;
+        entry.sampledCalls_ = 0;
+        entry.sampledTime_  = Duration{0};
+        entry.maxTime_      = Duration{0};
+    }
+}
+
+BindingProfiler::Entry* BindingProfiler::entry(std::string_view scope, std::string_view member, BindingKind kind) {
+    auto key  = std::format("{}.{}#{}", scope, member, kindName(kind));
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+        Entry entry{};
+        entry.scope_  = std::string{scope};
+        entry.member_ = std::string{member};
+        entry.kind_   = kind;
+        iter          = entries_.emplace(std::move(key), std::move(entry)).first;
+    }
+    return &iter->second;
+}
+
+std::vector<BindingProfiler::Entry> BindingProfiler::snapshot(SortBy sort) const {
+    std::vector<Entry> result;
+    result.reserve(entries_.size());
+    for (auto const& [key, entry] : entries_) {
+        if (entry.calls_ != 0) result.push_back(entry);
+    }
+    std::sort(result.begin(), result.end(), [sort](Entry const& lhs, Entry const& rhs) {
+        switch (sort) {
+        case SortBy::MaxTime:
+            return lhs.maxTime_ > rhs.maxTime_;
+        case SortBy::Calls:
+            return lhs.calls_ > rhs.calls_;
+        case SortBy::Exceptions:
+            return lhs.exceptions_ > rhs.exceptions_;
+        case SortBy::TotalTime:
+        default:
+            return lhs.totalTime() > rhs.totalTime();
+        }
+    });
+    return result;
+}
+
+std::string BindingProfiler::dumpText(SortBy sort, size_t limit) const {
+    auto entries = snapshot(sort);
+    if (limit != 0 && entries.size() > limit) entries.resize(limit);
+
+    std::ostringstream oss;
+    oss << std::format(
+        "{:<48} {:<12} {:>12} {:>14} {:>12} {:>12} {:>10}\n",
+        "binding",
+        "kind",
+        "calls",
+        "total(us)",
+        "avg(ns)",
+        "max(ns)",
+        "throws"
+    );
+    for (auto const& entry : entries) {
+        auto total = entry.totalTime().count();
+        oss << std::format(
+            "{:<48} {:<12} {:>12} {:>14.3f} {:>12} {:>12} {:>10}\n",
+            entry.name(),
+            kindName(entry.kind_),
+            entry.calls_,
+            static_cast<double>(total) / 1000.0,
+            entry.calls_ ? total / static_cast<Duration::rep>(entry.calls_) : 0,
+            entry.maxTime_.count(),
+            entry.exceptions_
+        );
+    }
+    return oss.str();
+}
+
+std::string BindingProfiler::dumpJson(SortBy sort, size_t limit) const {
+    auto entries = snapshot(sort);
+    if (limit != 0 && entries.size() > limit) entries.resize(limit);
+
+    std::string out = "[";
+    for (size_t i = 0; i < entries.size(); ++i) {
+        auto const& entry = entries[i];
+        if (i != 0) out.push_back(',');
+        out += "{\"scope\":";
+        detail::appendJsonString(out, entry.scope_);
+        out += ",\"member\":";
+        detail::appendJsonString(out, entry.member_);
+        out += std::format(
+            ",\"kind\":\"{}\",\"calls\":{},\"exceptions\":{},\"sampledCalls\":{},\"totalNs\":{},\"maxNs\":{}}}",
+            kindName(entry.kind_),
+            entry.calls_,
+            entry.exceptions_,
+            entry.sampledCalls_,
+            entry.totalTime().count(),
+            entry.maxTime_.count()
+        );
+    }
+    out.push_back(']');
+    return out;
+}
+
+
+} // namespace qjspp
+
+#endif // QJSPP_ENABLE_BINDING_PROFILER
@@ -0,0 +1,296 @@
+#include "qjspp/runtime/CpuProfiler.hpp"
+#include "qjspp/runtime/JsEngine.hpp"
+#include "qjspp/runtime/JsException.hpp"
+
+#include <algorithm>
+#include <format>
+#include <utility>
+
+#include "runtime/detail/JsonWriter.hpp"
+
+
+namespace qjspp {
+
+namespace {
+
+int64_t toMicros(CpuProfiler::Clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+}
+
+} // namespace
+
+
+CpuProfiler::CpuProfiler(JsEngine& engine) : engine_(engine) { reset(); }
+
+CpuProfiler::~CpuProfiler() { stop(); }
+
+void CpuProfiler::start() { start(Options{}); }
+void CpuProfiler::start(Options options) {
+    if (running_) return;
+
+    auto ctx    = engine_.context();
+    auto global = JS_GetGlobalObject(ctx);
+    errorCtor_  = JS_GetPropertyStr(ctx, global, "Error");
+    JS_FreeValue(ctx, global);
+    JsException::check(errorCtor_);
+
+    // 默认的 stackTraceLimit 较小，采样期间放宽以获得完整调用栈
+    savedStackTraceLimit_ = JS_GetPropertyStr(ctx, errorCtor_, "stackTraceLimit");
+    JS_SetPropertyStr(ctx, errorCtor_, "stackTraceLimit", JS_NewInt32(ctx, options.maxStackDepth));
+
+    options_ = options;
+    reset();
+    startTime_ = Clock::now();
+    endTime_   = startTime_;
+
+    running_ = true;
+    timer_   = std::thread{&CpuProfiler::timerLoop, this};
+}
+
+void CpuProfiler::stop() {
+    if (!running_) return;
+    {
+        std::lock_guard<std::mutex> lock{timerMutex_};
+        running_ = false;
+    }
+    timerCv_.notify_all();
+    if (timer_.joinable()) timer_.join();
+
+    samplePending_ = false;
+    endTime_       = Clock::now();
+
+    auto ctx = engine_.context();
+    if (JS_SetPropertyStr(ctx, errorCtor_, "stackTraceLimit", savedStackTraceLimit_) < 0) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+    }
+    savedStackTraceLimit_ = JS_UNDEFINED;
+    JS_FreeValue(ctx, errorCtor_);
+    errorCtor_ = JS_UNDEFINED;
+}
+
+bool CpuProfiler::isRunning() const { return running_; }
+
+void CpuProfiler::reset() {
+    nodes_.clear();
+    nodeIndex_.clear();
+    samples_.clear();
+    timestamps_.clear();
+
+    Node root{};
+    root.id_                  = 1;
+    root.frame_.functionName_ = "(root)";
+    nodes_.push_back(std::move(root));
+
+    startTime_ = endTime_ = Clock::now();
+}
+
+size_t CpuProfiler::sampleCount() const { return samples_.size(); }
+
+std::vector<CpuProfiler::Node> const& CpuProfiler::nodes() const { return nodes_; }
+
+
+void CpuProfiler::timerLoop() {
+    std::unique_lock<std::mutex> lock{timerMutex_};
+    while (running_) {
+        if (timerCv_.wait_for(lock, options_.interval, [this] { return !running_; })) {
+            break;
+        }
+        samplePending_ = true;
+    }
+}
+
+void CpuProfiler::onInterrupt() {
+    if (sampling_ || !samplePending_.exchange(false)) return;
+    sampling_ = true;
+    captureSample(Clock::now());
+    sampling_ = false;
+}
+
+void CpuProfiler::captureSample(Clock::time_point now) {
+    auto ctx = engine_.context();
+
+    // 从 C 调用 Error 构造函数，QuickJS 会跳过构造函数自身，stack 从被中断的帧开始
+    auto error = JS_CallConstructor(ctx, errorCtor_, 0, nullptr);
+    if (JS_IsException(error)) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return;
+    }
+    auto stack = JS_GetPropertyStr(ctx, error, "stack");
+    JS_FreeValue(ctx, error);
+
+    std::vector<CallFrame> frames;
+    if (JS_IsString(stack)) {
+        size_t len = 0;
+        if (auto str = JS_ToCStringLen(ctx, &len, stack)) {
+            frames = parseStackTrace({str, len});
+            JS_FreeCString(ctx, str);
+        }
+    } else if (JS_IsException(stack)) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+    }
+    JS_FreeValue(ctx, stack);
+
+    // 引擎空闲期间计时线程的请求不会被处理，以 (idle) 样本补齐时间线
+    auto last = timestamps_.empty() ? startTime_ : timestamps_.back();
+    if (now - last > options_.interval * 2) {
+        addSample(pseudoNode("(idle)"), last + options_.interval);
+    }
+
+    int node = 1;
+    if (frames.empty()) {
+        node = pseudoNode("(program)");
+    } else {
+        for (auto iter = frames.rbegin(); iter != frames.rend(); ++iter) {
+            node = childOf(node, *iter);
+        }
+    }
+    addSample(node, now);
+}
+
+void CpuProfiler::addSample(int node, Clock::time_point time) {
+    nodes_[node - 1].hitCount_++;
+    samples_.push_back(node);
+    timestamps_.push_back(time);
+}
+
+int CpuProfiler::childOf(int parent, CallFrame const& frame) {
+    auto key = std::format(
+        "{}|{}|{}|{}:{}{}",
+        parent,
+        frame.functionName_,
+        frame.url_,
+        frame.line_,
+        frame.column_,
+        frame.native_ ? "n" : ""
+    );
+    if (auto iter = nodeIndex_.find(key); iter != nodeIndex_.end()) {
+        return iter->second;
+    }
+
+    Node child{};
+    child.id_     = static_cast<int>(nodes_.size()) + 1;
+    child.parent_ = parent;
+    child.frame_  = frame;
+    nodes_[parent - 1].children_.push_back(child.id_);
+    nodeIndex_.emplace(std::move(key), child.id_);
+    nodes_.push_back(std::move(child));
+    return nodes_.back().id_;
+}
+
+int CpuProfiler::pseudoNode(std::string_view name) {
+    CallFrame frame{};
+    frame.functionName_ = std::string{name};
+    return childOf(1, frame);
+}
+
+
+std::string CpuProfiler::toCpuProfile() const {
+    std::unordered_map<std::string_view, int> scriptIds;
+
+    std::string out = "{\"nodes\":[";
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        auto const& node = nodes_[i];
+        if (i != 0) out.push_back(',');
+
+        int scriptId = 0;
+        if (!node.frame_.url_.empty()) {
+            scriptId = scriptIds.try_emplace(node.frame_.url_, static_cast<int>(scriptIds.size()) + 1).first->second;
+        }
+
+        out += std::format("{{\"id\":{},\"callFrame\":{{\"functionName\":", node.id_);
+        detail::appendJsonString(out, node.frame_.functionName_);
+        out += std::format(",\"scriptId\":\"{}\",\"url\":", scriptId);
+        detail::appendJsonString(out, node.frame_.url_);
+        // cpuprofile 的行列号从 0 开始
+        out += std::format(
+            ",\"lineNumber\":{},\"columnNumber\":{}}},\"hitCount\":{}",
+            node.frame_.line_ > 0 ? node.frame_.line_ - 1 : -1,
+            node.frame_.column_ > 0 ? node.frame_.column_ - 1 : -1,
+            node.hitCount_
+        );
+        if (!node.children_.empty()) {
+            out += ",\"children\":[";
+            for (size_t c = 0; c < node.children_.size(); ++c) {
+                if (c != 0) out.push_back(',');
+                out += std::to_string(node.children_[c]);
+            }
+            out.push_back(']');
+        }
+        out.push_back('}');
+    }
+
+    auto endTime = running_ ? Clock::now() : endTime_;
+    out += std::format("],\"startTime\":{},\"endTime\":{},\"samples\":[", toMicros(startTime_), toMicros(endTime));
+    for (size_t i = 0; i < samples_.size(); ++i) {
+        if (i != 0) out.push_back(',');
+        out += std::to_string(samples_[i]);
+    }
+    out += "],\"timeDeltas\":[";
+    auto last = startTime_;
+    for (size_t i = 0; i < timestamps_.size(); ++i) {
+        if (i != 0) out.push_back(',');
+        out  += std::to_string(toMicros(timestamps_[i]) - toMicros(last));
+        last  = timestamps_[i];
+    }
+    out += "]}";
+    return out;
+}
+
+std::string CpuProfiler::toTraceEvents() const {
+    std::string out   = "{\"traceEvents\":[";
+    bool        first = true;
+
+    auto emit = [&](int id, int64_t begin, int64_t end) {
+        auto const& frame = nodes_[id - 1].frame_;
+        if (!first) out.push_back(',');
+        first = false;
+
+        out += "{\"name\":";
+        detail::appendJsonString(out, frame.functionName_);
+        out += std::format(
+            ",\"cat\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":{},\"dur\":{},\"args\":{{\"url\":",
+            frame.native_ ? "native" : "js",
+            begin,
+            end - begin
+        );
+        detail::appendJsonString(out, frame.url_);
+        out += std::format(",\"line\":{},\"column\":{}}}}}", frame.line_, frame.column_);
+    };
+
+    // 每个样本占据 [t(i), t(i+1)) 区间，调用栈前缀相同的相邻样本合并为同一事件
+    std::vector<std::pair<int, int64_t>> open; // node id, begin
+    std::vector<int>                     path;
+    for (size_t i = 0; i < samples_.size(); ++i) {
+        auto time = toMicros(timestamps_[i]);
+
+        path.clear();
+        for (int id = samples_[i]; id > 1; id = nodes_[id - 1].parent_) {
+            path.push_back(id);
+        }
+        std::reverse(path.begin(), path.end());
+
+        size_t common = 0;
+        while (common < open.size() && common < path.size() && open[common].first == path[common]) {
+            ++common;
+        }
+        while (open.size() > common) {
+            emit(open.back().first, open.back().second, time);
+            open.pop_back();
+        }
+        for (size_t d = common; d < path.size(); ++d) {
+            open.emplace_back(path[d], time);
+        }
+    }
+
+    auto endTime = toMicros(running_ ? Clock::now() : endTime_);
+    while (!open.empty()) {
+        emit(open.back().first, open.back().second, endTime);
+        open.pop_back();
+    }
+
+    out += "],\"displayTimeUnit\":\"ms\"}";
+    return out;
+}
+
+
+} // namespace qjspp
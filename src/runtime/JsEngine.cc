@@ -5,9 +5,11 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -15,12 +17,15 @@
 #include "qjspp/bind/meta/ClassDefine.hpp"
 #include "qjspp/bind/meta/EnumDefine.hpp"
 #include "qjspp/bind/meta/ModuleDefine.hpp"
+#include "qjspp/runtime/CpuProfiler.hpp"
 #include "qjspp/runtime/JsEngine.hpp"
 #include "qjspp/runtime/JsException.hpp"
 #include "qjspp/runtime/Locker.hpp"
 #include "qjspp/runtime/TaskQueue.hpp"
 #include "qjspp/runtime/detail/BindRegistry.hpp"
+#include "qjspp/runtime/detail/FinalizeQueue.hpp"
 #include "qjspp/runtime/detail/ModuleLoader.hpp"
+#include "qjspp/runtime/detail/ResourcePool.hpp"
 #include "qjspp/types/Arguments.hpp"
 #include "qjspp/types/Function.hpp"
 #include "qjspp/types/String.hpp"
@@ -32,9 +37,57 @@ namespace qjspp {
 JsEngine::PauseGc::PauseGc(JsEngine* engine) : engine_(engine) { engine_->pauseGcCount_++; }
 JsEngine::PauseGc::~PauseGc() { engine_->pauseGcCount_--; }
 
+JsEngine::LatencyCriticalScope::LatencyCriticalScope(JsEngine& engine) : LatencyCriticalScope(&engine) {}
+JsEngine::LatencyCriticalScope::LatencyCriticalScope(JsEngine* engine) : engine_(engine) {
+    engine_->latencyCriticalCount_++;
+}
+JsEngine::LatencyCriticalScope::~LatencyCriticalScope() { engine_->latencyCriticalCount_--; }
+
+namespace {
+int64_t steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // namespace
+
+JsEngine::ExecutionScope::ExecutionScope(JsEngine* engine) : engine_(engine), prevDeadline_(engine->deadline_) {
+    if (engine_->executionDepth_++ == 0 && engine_->executionTimeout_.count() > 0) {
+        auto deadline = steadyNowNs() + std::chrono::nanoseconds{engine_->executionTimeout_}.count();
+        if (prevDeadline_ == 0 || deadline < prevDeadline_) {
+            engine_->deadline_ = deadline;
+        }
+    }
+}
+JsEngine::ExecutionScope::~ExecutionScope() {
+    if (--engine_->executionDepth_ == 0) {
+        engine_->deadline_           = prevDeadline_;
+        engine_->interruptReason_    = InterruptReason::None;
+        engine_->terminateRequested_ = false;
+    }
+}
+
+JsEngine::DeadlineScope::DeadlineScope(JsEngine& engine, std::chrono::milliseconds budget)
+: DeadlineScope(&engine, budget) {}
+JsEngine::DeadlineScope::DeadlineScope(JsEngine* engine, std::chrono::milliseconds budget)
+: engine_(engine),
+  prevDeadline_(engine->deadline_) {
+    auto deadline = steadyNowNs() + std::chrono::nanoseconds{budget}.count();
+    if (prevDeadline_ == 0 || deadline < prevDeadline_) {
+        engine_->deadline_ = deadline;
+    }
+}
+JsEngine::DeadlineScope::~DeadlineScope() { engine_->deadline_ = prevDeadline_; }
+
 
 /* JsEngine impl */
-JsEngine::JsEngine() : runtime_(JS_NewRuntime()), queue_(std::make_unique<TaskQueue>()) {
+JsEngine::JsEngine()
+: runtime_(JS_NewRuntime()),
+  aliveToken_(std::make_shared<char>()),
+  queue_(std::make_unique<TaskQueue>()) {
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+    profiler_ = std::make_unique<BindingProfiler>();
+#endif
+
     if (runtime_) {
         context_ = JS_NewContext(runtime_);
     }
@@ -75,28 +128,63 @@ JsEngine::JsEngine() : runtime_(JS_NewRuntime()), queue_(std::make_unique<TaskQu
             throw std::logic_error("Failed to get Symbol.toStringTag");
         }
         toStringTagSymbol_ = JS_ValueToAtom(context_, Value::extract(sym));
+
+        auto members       = eval("(Symbol('qjspp.members'))");
+        auto owner         = eval("(Symbol('qjspp.owner'))");
+        memberCacheSymbol_ = JS_ValueToAtom(context_, Value::extract(members));
+        memberOwnerSymbol_ = JS_ValueToAtom(context_, Value::extract(owner));
     }
 
-    bindRegistry_ = std::make_unique<detail::BindRegistry>(*this);
+    bindRegistry_  = std::make_unique<detail::BindRegistry>(*this);
+    cpuProfiler_   = std::make_unique<CpuProfiler>(*this);
+    resourcePool_  = detail::newManagedResourcePool();
+    finalizeQueue_ = std::make_unique<detail::FinalizeQueue>();
 
     JS_SetRuntimeOpaque(runtime_, this);
+    JS_SetInterruptHandler(runtime_, &JsEngine::interruptHandler, this);
     JS_SetContextOpaque(context_, this);
     JS_SetModuleLoaderFunc(runtime_, &detail::ModuleLoader::normalize, &detail::ModuleLoader::loader, this);
 }
 
 JsEngine::~JsEngine() {
+    // 此后 releaseValue 不再调度任务，等待已越过检查的调用结束，之后才能释放任务队列
     isDestroying_ = true;
+    waitReleasers();
+    {
+        Locker lock(this);          // 获取时释放 releaseValue 入队的值
+        finalizeQueue_->shutdown(); // 此后的 finalizer 直接析构
+    }
+    cpuProfiler_.reset();
     userData_.reset();
     queue_.reset();
 
     JS_FreeAtom(context_, lengthAtom_);
     JS_FreeAtom(context_, toStringTagSymbol_);
+    JS_FreeAtom(context_, memberCacheSymbol_);
+    JS_FreeAtom(context_, memberOwnerSymbol_);
+    for (auto const& atoms : atomCache_) {
+        for (auto atom : atoms) JS_FreeAtom(context_, atom);
+    }
+    atomCache_.clear();
 
     bindRegistry_.reset();
 
     JS_RunGC(runtime_);
+
+    // 析构期间其它线程入队的值在运行时释放前最后清空一次，此后 releaseValue 仅丢弃引用
+    releaseClosed_ = true;
+    waitReleasers();
+    drainReleaseList();
+
     JS_FreeContext(context_);
     JS_FreeRuntime(runtime_);
+
+    // 其它线程 (JsCallback::isAlive / reset) 可能正短暂持有令牌并访问引擎，等待其释放后再释放引擎对象
+    std::weak_ptr<void> token = aliveToken_;
+    aliveToken_.reset();
+    while (!token.expired()) {
+        std::this_thread::yield();
+    }
 }
 
 ::JSRuntime* JsEngine::runtime() const { return runtime_; }
@@ -112,9 +200,10 @@ void JsEngine::pumpJobs() {
     if (JS_IsJobPending(runtime_) && pumpScheduled_.compare_exchange_strong(no, true)) {
         queue_->postTask(
             [](void* data) {
-                auto       engine = static_cast<JsEngine*>(data);
-                JSContext* ctx    = nullptr;
-                Locker     lock(engine);
+                auto           engine = static_cast<JsEngine*>(data);
+                JSContext*     ctx    = nullptr;
+                Locker         lock(engine);
+                ExecutionScope execution(engine);
                 while (JS_ExecutePendingJob(engine->runtime_, &ctx) > 0) {}
                 engine->pumpScheduled_ = false;
             },
@@ -128,7 +217,8 @@ Value JsEngine::eval(String const& code, String const& source, EvalType type) {
     return eval(code.value(), source.isValid() ? source.value() : "<eval>", type);
 }
 Value JsEngine::eval(std::string const& code, std::string const& source, EvalType type) {
-    auto result = JS_Eval(
+    ExecutionScope execution(this);
+    auto           result = JS_Eval(
         context_,
         code.c_str(),
         code.size(),
@@ -167,6 +257,7 @@ Value JsEngine::loadScript(std::filesystem::path const& path, bool main) {
     detail::ModuleLoader::setModuleMainFlag(context_, module, main);
 
     // 3) 执行模块
+    ExecutionScope execution(this);
     result = JS_EvalFunction(context_, result);
     JsException::check(result); // SyntaxError
 
@@ -209,6 +300,7 @@ void JsEngine::loadByteCode(std::filesystem::path const& path, bool main) {
     }
 
     // 3) 执行模块
+    ExecutionScope execution(this);
     result = JS_EvalFunction(context_, result);
     JsException::check(result); // SyntaxError
 
@@ -236,6 +328,110 @@ void JsEngine::gc() {
     Locker lock(this);
     if (isDestroying() || pauseGcCount_ != 0) return;
     JS_RunGC(runtime_);
+    drainFinalizeQueue();
+    if (idleGcEnabled_) {
+        idleGcBaseline_ = getMemoryUsage();
+    }
+}
+
+void JsEngine::releaseValue(JSValue value) {
+    if (!JS_VALUE_HAS_REF_COUNT(value)) return;
+
+    if (Locker::currentEngine() == this) {
+        JS_FreeValue(context_, value);
+        return;
+    }
+
+    // 先登记再检查标志 (均为 seq_cst)，析构函数设置标志后等待计数归零，二者不会错过对方
+    releasers_.fetch_add(1);
+    if (releaseClosed_) {
+        releasers_.fetch_sub(1);
+        return; // 运行时即将释放，仅丢弃引用
+    }
+
+    auto node = new ReleaseNode{value, releaseList_.load(std::memory_order_relaxed)};
+    while (!releaseList_.compare_exchange_weak(node->next_, node, std::memory_order_release)) {}
+    if (node->next_ == nullptr && !isDestroying_) {
+        // 队列由空变为非空，调度一次 TaskQueue 任务，避免引擎空闲时值迟迟得不到释放
+        queue_->postTask([](void* data) { Locker lock(static_cast<JsEngine*>(data)); }, this);
+    }
+    releasers_.fetch_sub(1);
+}
+
+void JsEngine::waitReleasers() const {
+    while (releasers_.load() != 0) {
+        std::this_thread::yield();
+    }
+}
+
+void JsEngine::drainReleaseList() {
+    auto node = releaseList_.exchange(nullptr, std::memory_order_acquire);
+    while (node) {
+        JS_FreeValue(context_, node->value_);
+        auto next = node->next_;
+        delete node;
+        node = next;
+    }
+}
+
+void JsEngine::drainFinalizeQueue() {
+    if (isDestroying_ || !finalizeQueue_ || finalizeQueue_->empty()) return;
+    finalizeQueue_->drain();
+}
+
+void JsEngine::enableIdleGc() { enableIdleGc(IdleGcOptions{}); }
+void JsEngine::enableIdleGc(IdleGcOptions options) {
+    Locker lock(this);
+    disableIdleGc(); // reset previous options
+
+    idleGcOptions_   = options;
+    idleGcEnabled_   = true;
+    idleGcBaseline_  = getMemoryUsage();
+    idleGcLastCheck_ = {};
+    if (idleGcOptions_.disableAutoGc) {
+        autoGcThreshold_ = JS_GetGCThreshold(runtime_);
+        JS_SetGCThreshold(runtime_, std::numeric_limits<size_t>::max());
+    }
+    queue_->setIdleHandler([](void* data) { static_cast<JsEngine*>(data)->idleGc(); }, this);
+}
+
+void JsEngine::disableIdleGc() {
+    Locker lock(this);
+    if (!idleGcEnabled_) return;
+    queue_->setIdleHandler(nullptr);
+    if (idleGcOptions_.disableAutoGc) {
+        JS_SetGCThreshold(runtime_, autoGcThreshold_);
+    }
+    idleGcEnabled_ = false;
+}
+
+bool JsEngine::idleGc() {
+    if (isDestroying() || latencyCriticalCount_ != 0) return false;
+
+    std::unique_lock<std::recursive_mutex> guard(mutex_, std::try_to_lock);
+    if (!guard.owns_lock()) {
+        return false; // 引擎正被其它线程使用，不阻塞空闲循环
+    }
+    Locker lock(this);
+    if (!idleGcEnabled_ || pauseGcCount_ != 0) return false;
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - idleGcLastCheck_ < std::chrono::milliseconds(idleGcOptions_.checkIntervalMs)) {
+        return false;
+    }
+    idleGcLastCheck_ = now;
+
+    auto used = getMemoryUsage();
+    if (used < idleGcBaseline_) {
+        idleGcBaseline_ = used; // QuickJS 自动 GC 已回收
+    }
+    if (used - idleGcBaseline_ < idleGcOptions_.allocationThreshold) {
+        return false;
+    }
+    JS_RunGC(runtime_);
+    drainFinalizeQueue();
+    idleGcBaseline_ = getMemoryUsage();
+    return true;
 }
 
 size_t JsEngine::getMemoryUsage() {
@@ -245,14 +441,76 @@ size_t JsEngine::getMemoryUsage() {
     return usage.memory_used_size;
 }
 
+void JsEngine::setExecutionTimeout(std::chrono::milliseconds timeout) { executionTimeout_ = timeout; }
+
+std::chrono::milliseconds JsEngine::getExecutionTimeout() const { return executionTimeout_; }
+
+void JsEngine::terminate() { terminateRequested_ = true; }
+
+std::weak_ptr<void> JsEngine::getAliveToken() const { return aliveToken_; }
+
+JSAtom const* JsEngine::getCachedAtoms(size_t slot, std::span<std::string_view const> names) {
+    if (slot >= atomCache_.size()) {
+        atomCache_.resize(slot + 1);
+    }
+    auto& atoms = atomCache_[slot];
+    if (atoms.size() != names.size()) {
+        for (auto atom : atoms) JS_FreeAtom(context_, atom);
+        atoms.clear();
+        atoms.reserve(names.size());
+        for (auto name : names) {
+            auto atom = JS_NewAtomLen(context_, name.data(), name.size());
+            if (atom == JS_ATOM_NULL) [[unlikely]] {
+                for (auto created : atoms) JS_FreeAtom(context_, created);
+                atoms.clear();
+                JsException::check(-1, "Failed to create atom");
+            }
+            atoms.push_back(atom);
+        }
+    }
+    return atoms.data();
+}
+
+size_t JsEngine::allocateAtomCacheSlot() {
+    static std::atomic_size_t next{0};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
 TaskQueue* JsEngine::getTaskQueue() const { return queue_.get(); }
 
+CpuProfiler& JsEngine::getCpuProfiler() const { return *cpuProfiler_; }
+
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+BindingProfiler& JsEngine::getBindingProfiler() const { return *profiler_; }
+#endif
+
 void JsEngine::setData(std::shared_ptr<void> data) { userData_ = std::move(data); }
 
-bool JsEngine::registerClass(bind::meta::ClassDefine const& def) { return bindRegistry_->tryRegister(def); }
+bool JsEngine::registerClass(bind::meta::ClassDefine const& def, bool lazy) {
+    return bindRegistry_->tryRegister(def, lazy);
+}
 bool JsEngine::registerEnum(bind::meta::EnumDefine const& def) { return bindRegistry_->tryRegister(def); }
 bool JsEngine::registerModule(bind::meta::ModuleDefine const& module) { return bindRegistry_->tryRegister(module); }
 
+int JsEngine::interruptHandler(JSRuntime* /* rt */, void* opaque) {
+    auto engine = static_cast<JsEngine*>(opaque);
+    if (engine->cpuProfiler_ && engine->cpuProfiler_->isRunning()) {
+        engine->cpuProfiler_->onInterrupt();
+    }
+    if (engine->finalizeQueue_ && engine->finalizeQueue_->full()) {
+        engine->finalizeQueue_->drain(); // 长时间执行的脚本不会释放 Locker，在中断轮询时分批析构
+    }
+    if (engine->terminateRequested_.load(std::memory_order_relaxed)) {
+        engine->interruptReason_ = InterruptReason::Terminate;
+        return 1;
+    }
+    if (engine->deadline_ != 0 && steadyNowNs() >= engine->deadline_) {
+        engine->interruptReason_ = InterruptReason::Deadline;
+        return 1;
+    }
+    return 0;
+}
+
 void JsEngine::setObjectToStringTag(Object& obj, std::string_view tag) const {
     JS_DefinePropertyValue(
         context_,
@@ -265,26 +523,54 @@ void JsEngine::setObjectToStringTag(Object& obj, std::string_view tag) const {
 
 Object
 JsEngine::newInstance(bind::meta::ClassDefine const& def, std::unique_ptr<bind::JsManagedResource>&& managedResource) {
-    auto iter = bindRegistry_->instanceClasses_.find(&def);
-    if (iter == bindRegistry_->instanceClasses_.end()) {
-        throw std::logic_error{
-            std::format("The native class {} is not registered, so an instance cannot be constructed.", def.name_)
-        };
+    if (finalizeQueue_->full()) [[unlikely]] {
+        finalizeQueue_->drain();
     }
-    auto instance = JS_NewObjectClass(context_, static_cast<int>(kPointerClassId));
-    JsException::check(instance);
-    JS_SetOpaque(instance, managedResource.release());
-
-    std::array<JSValue, 1> args = {instance};
-
-    auto& ctor   = iter->second.first;
-    auto  result = JS_CallConstructor(context_, ctor, args.size(), args.data());
+    return bindRegistry_->newInstance(def, std::move(managedResource));
+}
 
-    JS_FreeValue(context_, instance);
-    JsException::check(result);
-    pumpJobs();
+Object JsEngine::newInstanceOfMember(
+    bind::meta::ClassDefine const& def,
+    void*                          member,
+    Object const&                  ownerJs,
+    uint32_t                       slot
+) {
+    auto owner = Value::extract(ownerJs);
+
+    auto holder = JS_GetProperty(context_, owner, memberCacheSymbol_);
+    JsException::check(holder);
+    if (JS_IsObject(holder)) {
+        auto cached = JS_GetPropertyUint32(context_, holder, slot);
+        if (JS_IsException(cached)) JS_FreeValue(context_, holder);
+        JsException::check(cached);
+        if (JS_IsObject(cached)) {
+            auto obj = Value::move<Object>(cached);
+            if (getNativeInstanceOf(obj, def) == member) { // 成员访问器返回的指针可能变化
+                JS_FreeValue(context_, holder);
+                return obj;
+            }
+        }
+    } else {
+        holder = JS_NewObjectProto(context_, JS_NULL);
+        JsException::check(holder);
+        // owner 不可扩展 (Object.freeze 等) 时无法缓存，回退为由包装对象持有 owner
+        auto ok = JS_DefinePropertyValue(context_, owner, memberCacheSymbol_, JS_DupValue(context_, holder), 0);
+        if (ok <= 0) {
+            if (ok < 0) JS_FreeValue(context_, JS_GetException(context_));
+            JS_FreeValue(context_, holder);
+            return newInstanceOfView(def, member, ownerJs);
+        }
+    }
 
-    return Value::move<Object>(result);
+    auto obj = newInstanceOfView(def, member);
+    auto val = Value::extract(obj);
+    auto ret = JS_DefinePropertyValue(context_, val, memberOwnerSymbol_, JS_DupValue(context_, owner), 0);
+    if (ret >= 0) {
+        ret = JS_SetPropertyUint32(context_, holder, slot, JS_DupValue(context_, val));
+    }
+    JS_FreeValue(context_, holder);
+    JsException::check(ret);
+    return obj;
 }
 
 bool JsEngine::isInstanceOf(Object const& thiz, bind::meta::ClassDefine const& def) const {
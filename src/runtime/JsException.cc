@@ -1,21 +1,75 @@
 #include "qjspp/runtime/JsException.hpp"
+#include "qjspp/runtime/JsEngine.hpp"
 #include "qjspp/runtime/Locker.hpp"
 #include "qjspp/types/Object.hpp"
 #include "qjspp/types/String.hpp"
 #include "qjspp/types/Value.hpp"
 #include "quickjs.h"
 
+#include <cassert>
 #include <exception>
+#include <optional>
+#include <string_view>
 
 
 namespace qjspp {
 
 struct JsException::ExceptionContext {
-    Type                type_{Type::Any};
-    mutable std::string message_{};
-    Value               exception_{};
+    Type                     type_{Type::Any};
+    mutable std::string      message_{};
+    Value                    exception_{};
+    std::optional<ErrorInfo> info_{}; // errorInfo() 首次调用时捕获，exception() 创建异常对象时刷新
 };
 
+namespace {
+
+std::string_view typeName(JsException::Type type) {
+    switch (type) {
+    case JsException::Type::RangeError:
+        return "RangeError";
+    case JsException::Type::ReferenceError:
+        return "ReferenceError";
+    case JsException::Type::SyntaxError:
+        return "SyntaxError";
+    case JsException::Type::TypeError:
+        return "TypeError";
+    case JsException::Type::InternalError:
+    case JsException::Type::Terminated:
+        return "InternalError";
+    case JsException::Type::Any:
+    default:
+        return "Error";
+    }
+}
+
+// 转换为 std::string，失败时丢弃引擎中的异常并返回空字符串
+std::string toStdString(JSContext* ctx, JSValueConst value) {
+    size_t len = 0;
+    auto   str = JS_ToCStringLen(ctx, &len, value);
+    if (!str) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return {};
+    }
+    std::string result{str, len};
+    JS_FreeCString(ctx, str);
+    return result;
+}
+
+// 读取字符串属性，属性不存在或不是字符串时返回空字符串 (不触发 toString)
+std::string getStringProperty(JSContext* ctx, JSValueConst object, char const* prop) {
+    auto        value = JS_GetPropertyStr(ctx, object, prop);
+    std::string result;
+    if (JS_IsString(value)) {
+        result = toStdString(ctx, value);
+    } else if (JS_IsException(value)) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+    }
+    JS_FreeValue(ctx, value);
+    return result;
+}
+
+} // namespace
+
 JsException::JsException(std::string message, Type type) : qjspp::JsException{type, std::move(message)} {}
 JsException::JsException(Type type, std::string message)
 : std::exception(),
@@ -65,16 +119,30 @@ Value JsException::exception() const noexcept {
             JS_Throw(ctx, Value::extract(String(data_->message_)));
         }
         data_->exception_ = Value::move<Value>(JS_GetException(ctx));
+        if (data_->info_) {
+            // 已有的快照来自尚未抛入引擎的状态，改为从刚创建的异常对象重新捕获 (就地更新，已取得的引用仍然有效)
+            try {
+                captureErrorInfo();
+            } catch (...) {}
+        }
     }
     return data_->exception_;
 }
 
 std::string JsException::stacktrace() const noexcept {
     try {
-        return data_->exception_.asObject().get("stack").asString().value();
-    } catch (JsException const&) {
-        return "[ERROR: failed to obtain stacktrace]";
+        if (auto const& info = errorInfo(); !info.stack_.empty()) {
+            return info.stack_;
+        }
+    } catch (...) {}
+    return "[ERROR: failed to obtain stacktrace]";
+}
+
+JsException::ErrorInfo const& JsException::errorInfo() const {
+    if (!data_->info_) {
+        captureErrorInfo();
     }
+    return *data_->info_;
 }
 
 JSValue JsException::rethrowToEngine() const {
@@ -90,17 +158,37 @@ void JsException::extractMessage() const noexcept {
         return;
     }
     try {
-        if (data_->exception_.isString()) {
-            data_->message_ = data_->exception_.asString().value();
-            return; // 非标准异常
-        }
-        auto obj        = data_->exception_.asObject();
-        data_->message_ = obj.get("message").asString().value();
-    } catch (JsException const&) {
+        data_->message_ = errorInfo().message_;
+    } catch (...) {
         data_->message_ = "[ERROR: failed to obtain message]";
     }
 }
 
+void JsException::captureErrorInfo() const {
+    ErrorInfo info{};
+    info.type_ = data_->type_;
+    if (data_->exception_.isUndefined()) {
+        // C++ 侧构造且尚未抛入引擎，没有脚本调用栈
+        info.name_    = typeName(data_->type_);
+        info.message_ = data_->message_;
+    } else {
+        auto ctx   = Locker::currentContextChecked();
+        auto value = Value::extract(data_->exception_);
+        if (JS_IsObject(value)) {
+            info.name_    = getStringProperty(ctx, value, "name");
+            info.message_ = getStringProperty(ctx, value, "message");
+            info.stack_   = getStringProperty(ctx, value, "stack");
+            info.frames_  = parseStackTrace(info.stack_);
+        } else {
+            info.message_ = toStdString(ctx, value); // 非标准异常 (throw "str" 等)
+        }
+        if (!data_->message_.empty()) {
+            info.message_ = data_->message_; // C++ 侧指定的消息优先 (例如 Terminated)
+        }
+    }
+    data_->info_ = std::move(info);
+}
+
 
 // helpers
 void JsException::check(JSValue value) {
@@ -115,7 +203,17 @@ void JsException::check(int code, const char* msg) {
         auto error = JS_GetException(ctx);
 
         if (JS_IsObject(error)) {
-            throw JsException(Value::move<Value>(error));
+            auto exception = JsException(Value::move<Value>(error));
+            auto engine    = static_cast<JsEngine*>(JS_GetContextOpaque(ctx));
+            if (engine && engine->interruptReason_ != JsEngine::InterruptReason::None
+                && JS_IsUncatchableError(ctx, error)) {
+                // 由中断回调产生的不可捕获异常，原样保留以便向外层 JS 帧继续传播
+                exception.data_->type_    = Type::Terminated;
+                exception.data_->message_ = engine->interruptReason_ == JsEngine::InterruptReason::Deadline
+                                              ? "execution deadline exceeded"
+                                              : "execution terminated";
+            }
+            throw exception;
         } else {
             JS_FreeValue(ctx, error);
             throw JsException(msg);
@@ -123,5 +221,33 @@ void JsException::check(int code, const char* msg) {
     }
 }
 
+Value JsException::raise(Type type, char const* message) noexcept {
+    auto engine = Locker::currentEngine();
+    assert(engine != nullptr && "raise() requires an active Locker");
+    auto ctx = engine->context();
+    switch (type) {
+    case Type::RangeError:
+        JS_ThrowRangeError(ctx, "%s", message);
+        break;
+    case Type::ReferenceError:
+        JS_ThrowReferenceError(ctx, "%s", message);
+        break;
+    case Type::SyntaxError:
+        JS_ThrowSyntaxError(ctx, "%s", message);
+        break;
+    case Type::TypeError:
+        JS_ThrowTypeError(ctx, "%s", message);
+        break;
+    case Type::InternalError:
+    case Type::Terminated:
+        JS_ThrowInternalError(ctx, "%s", message);
+        break;
+    case Type::Any:
+    default:
+        JS_ThrowPlainError(ctx, "%s", message);
+    }
+    return Value::move<Value>(JS_EXCEPTION);
+}
+
 
 } // namespace qjspp
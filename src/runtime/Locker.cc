@@ -4,7 +4,8 @@
 
 namespace qjspp {
 
-thread_local Locker* Locker::gCurrentScope_ = nullptr;
+thread_local Locker*      Locker::gCurrentScope_   = nullptr;
+thread_local ::JSRuntime* Locker::gCurrentRuntime_ = nullptr;
 
 Locker::Locker(JsEngine& engine) : Locker(&engine) {}
 Locker::Locker(JsEngine* engine) : engine_(engine), prev_(gCurrentScope_) {
@@ -12,16 +13,22 @@ Locker::Locker(JsEngine* engine) : engine_(engine), prev_(gCurrentScope_) {
         this->prev_->engine_->mutex_.unlock();
     }
     this->engine_->mutex_.lock();
-    gCurrentScope_ = this;
+    gCurrentScope_   = this;
+    gCurrentRuntime_ = this->engine_->runtime_;
     JS_UpdateStackTop(this->engine_->runtime_);
+    if (this->engine_->releaseList_.load(std::memory_order_relaxed)) {
+        this->engine_->drainReleaseList(); // 其它线程 releaseValue 入队的值
+    }
 }
 Locker::~Locker() {
+    this->engine_->drainFinalizeQueue();
     this->engine_->pumpJobs();
     this->engine_->mutex_.unlock();
     if (prev_) {
         this->prev_->engine_->mutex_.lock();
     }
-    gCurrentScope_ = this->prev_;
+    gCurrentScope_   = this->prev_;
+    gCurrentRuntime_ = this->prev_ ? this->prev_->engine_->runtime_ : nullptr;
 }
 
 JsEngine* Locker::currentEngine() {
@@ -44,7 +51,12 @@ std::tuple<::JSRuntime*, ::JSContext*> Locker::currentRuntimeAndContextChecked()
     return std::make_tuple(current.runtime_, current.context_);
 }
 
-::JSRuntime* Locker::currentRuntimeChecked() { return currentEngineChecked().runtime_; }
+::JSRuntime* Locker::currentRuntimeChecked() {
+    if (gCurrentRuntime_ == nullptr) [[unlikely]] {
+        throw std::logic_error("Failed to get current runtime, no Locker is active!");
+    }
+    return gCurrentRuntime_;
+}
 
 ::JSContext* Locker::currentContextChecked() { return currentEngineChecked().context_; }
 
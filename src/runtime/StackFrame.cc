@@ -0,0 +1,64 @@
+#include "qjspp/runtime/StackFrame.hpp"
+
+#include <algorithm>
+#include <charconv>
+
+
+namespace qjspp {
+
+namespace {
+
+bool parseInt(std::string_view str, int& out) {
+    auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), out);
+    return ec == std::errc{} && ptr == str.data() + str.size();
+}
+
+} // namespace
+
+
+std::vector<StackFrame> parseStackTrace(std::string_view stack) {
+    // QuickJS 调用栈格式:
+    //     at add (native)
+    //     at foo (main.js:3:12)
+    std::vector<StackFrame> frames;
+    while (!stack.empty()) {
+        auto eol  = stack.find('\n');
+        auto line = stack.substr(0, eol);
+        stack     = eol == std::string_view::npos ? std::string_view{} : stack.substr(eol + 1);
+
+        line.remove_prefix(std::min(line.find_first_not_of(' '), line.size()));
+        if (!line.starts_with("at ")) continue;
+        line.remove_prefix(3);
+
+        StackFrame frame{};
+        auto       open = line.rfind(" (");
+        if (open == std::string_view::npos || !line.ends_with(')')) {
+            frame.functionName_ = std::string{line};
+            frames.push_back(std::move(frame));
+            continue;
+        }
+        frame.functionName_ = std::string{line.substr(0, open)};
+
+        auto location = line.substr(open + 2, line.size() - open - 3);
+        if (location == "native") {
+            frame.native_ = true;
+        } else {
+            auto colSep  = location.rfind(':');
+            auto lineSep = colSep == std::string_view::npos ? colSep : location.rfind(':', colSep - 1);
+            if (lineSep != std::string_view::npos
+                && parseInt(location.substr(lineSep + 1, colSep - lineSep - 1), frame.line_)
+                && parseInt(location.substr(colSep + 1), frame.column_)) {
+                frame.url_ = std::string{location.substr(0, lineSep)};
+            } else {
+                frame.line_   = -1;
+                frame.column_ = -1;
+                frame.url_    = std::string{location};
+            }
+        }
+        frames.push_back(std::move(frame));
+    }
+    return frames;
+}
+
+
+} // namespace qjspp
@@ -27,6 +27,8 @@ void TaskQueue::postTask(TaskCallback callback, void* data, int delayMs) {
 
 bool TaskQueue::loopOnce() {
     std::vector<Task> dueTasks;
+    TaskCallback      idleCallback = nullptr;
+    void*             idleData     = nullptr;
 
     {
         std::lock_guard<std::mutex> lock(mutex_);
@@ -36,6 +38,8 @@ bool TaskQueue::loopOnce() {
             dueTasks.push_back(tasks_.top());
             tasks_.pop();
         }
+        idleCallback = idleCallback_;
+        idleData     = idleData_;
     }
 
     // 执行到期的任务
@@ -43,6 +47,11 @@ bool TaskQueue::loopOnce() {
         task.callback_(task.data_);
     }
 
+    // 没有到期任务，本轮循环空闲
+    if (dueTasks.empty() && idleCallback && !shutdown_) {
+        idleCallback(idleData);
+    }
+
     return !dueTasks.empty(); // 如果有任务执行，返回true
 }
 
@@ -64,6 +73,12 @@ void TaskQueue::loopAndWait() {
     }
 }
 
+void TaskQueue::setIdleHandler(TaskCallback callback, void* data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    idleCallback_ = callback;
+    idleData_     = data;
+}
+
 void TaskQueue::shutdown(bool wait) {
     {
         std::lock_guard<std::mutex> lock(mutex_);
@@ -3,6 +3,7 @@
 #include "qjspp/runtime/JsEngine.hpp"
 #include "qjspp/runtime/JsException.hpp"
 #include "qjspp/runtime/Locker.hpp"
+#include "qjspp/runtime/detail/FinalizeQueue.hpp"
 #include "qjspp/runtime/detail/FunctionFactory.hpp"
 #include "qjspp/types/Arguments.hpp"
 #include "qjspp/types/Boolean.hpp"
@@ -10,6 +11,7 @@
 #include "qjspp/types/Number.hpp"
 #include "qjspp/types/String.hpp"
 #include "qjspp/types/Value.hpp"
+#include "qjspp/types/ValueRef.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -38,10 +40,14 @@ bool BindRegistry::tryRegister(bind::meta::EnumDefine const& enumDef) {
     return true;
 }
 
-bool BindRegistry::tryRegister(bind::meta::ClassDefine const& classDef) {
-    if (instanceClasses_.contains(&classDef)) {
+bool BindRegistry::tryRegister(bind::meta::ClassDefine const& classDef, bool lazy) {
+    if (instanceClasses_.contains(&classDef) || lazyClasses_.contains(&classDef)) {
         return false;
     }
+    if (lazy) {
+        _installLazyClass(classDef);
+        return true;
+    }
     auto v = _registerClass(classDef);
     engine_.globalThis().set(classDef.name_, v);
     return true;
@@ -74,7 +80,7 @@ Value BindRegistry::_registerClass(bind::meta::ClassDefine const& def) {
     bool const isInstance = def.hasConstructor();
     if (!isInstance) {
         auto object = Object::newObject();
-        _buildClassStatic(def.staticMemberDef_, object);
+        _buildClassStatic(def, object);
         engine_.setObjectToStringTag(object, def.name_);
         staticClasses_.emplace(&def, object);
         return object;
@@ -99,7 +105,7 @@ Value BindRegistry::_registerClass(bind::meta::ClassDefine const& def) {
     {
         auto asObject = Value::wrap<Object>(Value::extract(ctor));
         engine_.setObjectToStringTag(asObject, def.name_);
-        _buildClassStatic(def.staticMemberDef_, asObject);
+        _buildClassStatic(def, asObject);
     }
 
     JS_SetConstructor(engine_.context_, Value::extract(ctor), Value::extract(proto));
@@ -116,6 +122,10 @@ Value BindRegistry::_registerClass(bind::meta::ClassDefine const& def) {
             );
         }
         auto iter = instanceClasses_.find(def.base_);
+        if (iter == instanceClasses_.end() && lazyClasses_.contains(def.base_)) {
+            _materializeClass(*def.base_);
+            iter = instanceClasses_.find(def.base_);
+        }
         if (iter == instanceClasses_.end()) {
             throw std::logic_error(
                 std::format(
@@ -146,6 +156,74 @@ Value BindRegistry::_registerClass(bind::meta::ClassDefine const& def) {
     return ctor;
 }
 
+void BindRegistry::_installLazyClass(bind::meta::ClassDefine const& def) {
+    // 同一函数兼作 getter 与 setter：读取时构建类，赋值时直接以新值覆盖
+    auto accessor = FunctionFactory::create(
+        engine_,
+        const_cast<bind::meta::ClassDefine*>(&def),
+        nullptr,
+        [](Arguments const& args, void* data1, void*) -> Value {
+            auto  def      = static_cast<bind::meta::ClassDefine const*>(data1);
+            auto& registry = *args.engine()->bindRegistry_;
+            if (!registry.lazyClasses_.contains(def)) {
+                // 类已构建，脚本保留的访问器返回已有的类对象，赋值不再生效
+                if (args.length() != 0) return {};
+                if (auto iter = registry.instanceClasses_.find(def); iter != registry.instanceClasses_.end()) {
+                    return Value::wrap<Value>(iter->second.first);
+                }
+                if (auto iter = registry.staticClasses_.find(def); iter != registry.staticClasses_.end()) {
+                    return iter->second;
+                }
+                return {};
+            }
+            if (args.length() != 0) {
+                registry.lazyClasses_[def] = false;
+                args.engine()->globalThis().defineOwnProperty(def->name_, args[0]);
+                return {};
+            }
+            try {
+                return registry._materializeClass(*def);
+            } catch (JsException const&) {
+                throw;
+            } catch (std::exception const& e) {
+                return JsException::raise(JsException::Type::InternalError, e.what());
+            }
+        },
+        BindingKind::Getter,
+        def.name_,
+        "(lazy)"
+    );
+
+    auto global = JS_GetGlobalObject(engine_.context_);
+    auto atom   = JS_NewAtomLen(engine_.context_, def.name_.data(), def.name_.size());
+    auto ret    = JS_DefinePropertyGetSet(
+        engine_.context_,
+        global,
+        atom,
+        JS_DupValue(engine_.context_, Value::extract(accessor)),
+        JS_DupValue(engine_.context_, Value::extract(accessor)),
+        JS_PROP_CONFIGURABLE | JS_PROP_ENUMERABLE
+    );
+    JS_FreeAtom(engine_.context_, atom);
+    JS_FreeValue(engine_.context_, global);
+    JsException::check(ret);
+    lazyClasses_.emplace(&def, true);
+}
+
+Value BindRegistry::_materializeClass(bind::meta::ClassDefine const& def) {
+    auto iter = lazyClasses_.find(&def);
+    assert(iter != lazyClasses_.end());
+    bool const pending = iter->second;
+
+    auto v = _registerClass(def);
+    lazyClasses_.erase(&def); // _registerClass 可能构建基类，迭代器不再有效
+    if (pending) {
+        // 以数据属性替换全局访问器 (set 会再次进入访问器)
+        engine_.globalThis().defineOwnProperty(def.name_, v);
+    }
+    return v;
+}
+
 Function BindRegistry::_buildClassConstructor(bind::meta::ClassDefine const& def) const {
     auto ctor = FunctionFactory::create(
         engine_,
@@ -156,58 +234,61 @@ Function BindRegistry::_buildClassConstructor(bind::meta::ClassDefine const& def
             auto engine = args.engine();
 
             if (!JS_IsConstructor(engine->context_, args.thiz_)) [[unlikely]] {
-                throw JsException{
+                return JsException::raise(
                     JsException::Type::TypeError,
                     "Native class constructor cannot be called as a function"
-                };
+                );
             }
 
-            JSValue proto = JS_GetPropertyStr(engine->context_, args.thiz_, "prototype");
-            JsException::check(proto);
-
-            auto obj =
-                JS_NewObjectProtoClass(engine->context_, proto, static_cast<int>(def->instanceMemberDef_.classId_));
-            JS_FreeValue(engine->context_, proto);
+            auto  ctx      = engine->context_;
+            auto  classId  = def->instanceMemberDef_.classId_;
+            auto& registry = *engine->bindRegistry_;
+
+            JSValue obj;
+            if (auto iter = registry.instanceClasses_.find(def);
+                iter != registry.instanceClasses_.end()
+                && JS_VALUE_GET_PTR(iter->second.first) == JS_VALUE_GET_PTR(args.thiz_)) {
+                // new Class(): 直接使用缓存的原型，省去 new.target.prototype 的属性查找
+                obj = JS_NewObjectProtoClass(ctx, iter->second.second, classId);
+            } else {
+                // 派生类 (class Foo extends Class) 以 new.target.prototype 为原型
+                JSValue proto = JS_GetPropertyStr(ctx, args.thiz_, "prototype");
+                JsException::check(proto);
+                obj = JS_NewObjectProtoClass(ctx, proto, classId);
+                JS_FreeValue(ctx, proto);
+            }
             JsException::check(obj);
 
-            void* instance        = nullptr;
-            bool  constructFromJs = true;
-            if (args.length_ == 1) {
-                auto rawArg0 = Value::extract(args[0]);
-                auto id      = JS_GetClassID(rawArg0);
-                if (auto ptr = JS_GetOpaque(rawArg0, id)) {
-                    assert(id != JS_INVALID_CLASS_ID);
-                    assert(id == engine->kPointerClassId);
-                    instance        = ptr; // construct from c++
-                    constructFromJs = false;
-                }
+            auto& unConst = const_cast<Arguments&>(args);
+            unConst.thiz_ = obj;
+            auto instance = (def->instanceMemberDef_.constructor_)(args);
+            if (!instance) [[unlikely]] {
+                JS_FreeValue(ctx, obj); // 未设置 opaque，finalizer 不做处理
+                return JsException::raise(JsException::Type::TypeError, "This native class cannot be constructed.");
             }
 
-            if (!instance) { // construct from js
-                auto& unConst = const_cast<Arguments&>(args);
-                unConst.thiz_ = obj;
-                instance      = (def->instanceMemberDef_.constructor_)(args);
-                if (!instance) [[unlikely]] {
-                    throw JsException{JsException::Type::TypeError, "This native class cannot be constructed."};
-                }
-            }
-
-            // 对于从 C++ 构造的脚本对象，instance 已是 JsManagedResource 无需进行托管
-            // 对于从 脚本 构造的对象，instance 从绑定构造函数里获得，其为原始指针，需要进行托管
+            // 从脚本构造的对象，instance 从绑定构造函数里获得，其为原始指针，需要进行托管
             // 对于禁止脚本构造的类，绑定构造函数应该返回 nullptr 并在上方步骤抛出异常拦截
+            // 从 C++ 构造的对象不经过构造函数，见 BindRegistry::newInstance
             // 注意：脚本禁止构造的类，默认不会生成托管工厂方法，如果调用会抛出 logic_error
-            void* managed = constructFromJs ? def->manage(instance).release() : instance;
+            auto managed = def->manage(instance).release();
             {
                 auto typed     = static_cast<bind::JsManagedResource*>(managed);
                 typed->define_ = def;
                 typed->engine_ = engine;
 
-                (*const_cast<bool*>(&typed->constructFromJs_)) = constructFromJs;
+                (*const_cast<bool*>(&typed->constructFromJs_)) = true;
             }
 
             JS_SetOpaque(obj, managed);
+            if (def->identityCache_) {
+                registry._cacheIdentity(*def, static_cast<bind::JsManagedResource*>(managed), obj);
+            }
             return Value::move<Value>(obj);
-        }
+        },
+        BindingKind::Constructor,
+        def.name_,
+        "constructor"
     );
 
     auto obj = JS_DupValue(engine_.context_, Value::extract(ctor));
@@ -215,6 +296,82 @@ Function BindRegistry::_buildClassConstructor(bind::meta::ClassDefine const& def
     return Value::move<Function>(obj);
 }
 
+Object BindRegistry::newInstance(
+    bind::meta::ClassDefine const&             def,
+    std::unique_ptr<bind::JsManagedResource>&& managedResource
+) {
+    auto iter = instanceClasses_.find(&def);
+    if (iter == instanceClasses_.end() && lazyClasses_.contains(&def)) [[unlikely]] {
+        _materializeClass(def);
+        iter = instanceClasses_.find(&def);
+    }
+    if (iter == instanceClasses_.end()) {
+        throw std::logic_error{
+            std::format("The native class {} is not registered, so an instance cannot be constructed.", def.name_)
+        };
+    }
+
+    if (def.identityCache_) {
+        auto& cache = identityCache_[&def];
+        if (auto hit = cache.find(managedResource->get()); hit != cache.end()) {
+            if (managedResource->ownership_ != bind::JsManagedResource::Ownership::None) {
+                _adoptResource(def, hit->second, std::move(managedResource));
+            }
+            managedResource.reset(); // 复用已有包装对象，未被接管的托管资源直接释放
+            return Value::wrap<Object>(hit->second);
+        }
+    }
+
+    // 直接以缓存的原型创建包装对象，不经过构造函数与参数探测
+    auto obj = JS_NewObjectProtoClass(engine_.context_, iter->second.second, def.instanceMemberDef_.classId_);
+    JsException::check(obj);
+
+    auto managed     = managedResource.release();
+    managed->define_ = &def;
+    managed->engine_ = &engine_;
+    JS_SetOpaque(obj, managed);
+    if (def.identityCache_) {
+        _cacheIdentity(def, managed, obj);
+    }
+    return Value::move<Object>(obj);
+}
+
+void BindRegistry::_adoptResource(
+    bind::meta::ClassDefine const&             def,
+    JSValue                                    obj,
+    std::unique_ptr<bind::JsManagedResource>&& managedResource
+) {
+    using Ownership = bind::JsManagedResource::Ownership;
+
+    auto cached = static_cast<bind::JsManagedResource*>(JS_GetOpaque(obj, def.instanceMemberDef_.classId_));
+    if (cached->ownership_ != Ownership::None) {
+        // 两者都是 shared_ptr：已有包装对象持有强引用，新的引用直接释放即可
+        if (cached->ownership_ == Ownership::Shared && managedResource->ownership_ == Ownership::Shared) return;
+        // 其余组合为重复所有权，任何一方析构实例都会使另一方悬垂，不析构也不释放新传入的资源
+        managedResource->resource_ = nullptr;
+        throw std::logic_error{
+            std::format("The native instance of {} is already owned by another wrapper.", def.name_)
+        };
+    }
+
+    // 已有包装对象不持有实例 (视图 / 持有 owner 的视图 / weak_ptr)：由其接管新的托管资源
+    // weak_ptr 随之升级为 shared_ptr，实例随包装对象回收而析构
+    // 旧资源可能仍被正在进行的原生调用引用 (Pin / Arguments)，随新资源一同释放
+    auto managed          = managedResource.release();
+    managed->define_      = cached->define_;
+    managed->engine_      = cached->engine_;
+    managed->identityKey_ = cached->identityKey_;
+    managed->adopted_     = cached;
+    JS_SetOpaque(obj, managed);
+}
+
+void BindRegistry::_cacheIdentity(bind::meta::ClassDefine const& def, bind::JsManagedResource* managed, JSValue obj) {
+    auto key = managed->get();
+    if (key == nullptr) return; // weak_ptr 已失效等
+    managed->identityKey_ = key;
+    identityCache_[&def].insert_or_assign(key, obj);
+}
+
 bool ClassDefineCheckHelper(bind::meta::ClassDefine const* def, bind::meta::ClassDefine const* target) {
     // TODO(optimization): For each ClassDefine, maintain a cached unordered_set of all ancestor classes.
     // Then implement isFamily(target) to quickly check if a class is derived from target.
@@ -234,6 +391,27 @@ constexpr bool kInstanceCallCheckClassDefine = true;
 constexpr bool kInstanceCallCheckClassDefine = false; // 跳过实例调用时检查类定义
 #endif
 
+template <typename Invoke>
+Value BindRegistry::_invokeInstanceMember(Arguments const& args, void* define, Invoke&& invoke) {
+    auto const classID = JS_GetClassID(args.thiz_);
+    assert(classID != JS_INVALID_CLASS_ID);
+
+    auto managed = static_cast<bind::JsManagedResource*>(JS_GetOpaque(args.thiz_, classID));
+
+    bind::JsManagedResource::Pin pin{*managed}; // weak_ptr 资源在本次调用期间保持存活
+    auto                         instance = managed->get();
+    if (instance == nullptr) [[unlikely]] {
+        return JsException::raise(JsException::Type::ReferenceError, "object is no longer available");
+    }
+    if (kInstanceCallCheckClassDefine
+        && !ClassDefineCheckHelper(managed->define_, static_cast<bind::meta::ClassDefine*>(define))) [[unlikely]] {
+        return JsException::raise(JsException::Type::TypeError, "This object is not a valid instance of this class.");
+    }
+    const_cast<Arguments&>(args).managed_ = managed; // for Arguments::getJsManagedResource
+
+    return invoke(instance);
+}
+
 Object BindRegistry::_buildClassPrototype(bind::meta::ClassDefine const& def) const {
     auto prototype = Object::newObject();
     auto definePtr = const_cast<bind::meta::ClassDefine*>(&def);
@@ -241,67 +419,67 @@ Object BindRegistry::_buildClassPrototype(bind::meta::ClassDefine const& def) co
 #ifndef QJSPP_DONT_GENERATE_HELPER_EQLAUS_METHDO
     prototype.set(
         "$equals",
-        FunctionFactory::create(engine_, definePtr, nullptr, [](Arguments const& args, void* data1, void*) -> Value {
-            auto const classID = JS_GetClassID(args.thiz_);
-            assert(classID != JS_INVALID_CLASS_ID);
-
-            auto managed  = static_cast<bind::JsManagedResource*>(JS_GetOpaque(args.thiz_, classID));
-            auto instance = (*managed)();
-            if (instance == nullptr) [[unlikely]] {
-                throw JsException{JsException::Type::ReferenceError, "object is no longer available"};
-            }
-            if (kInstanceCallCheckClassDefine
-                && !ClassDefineCheckHelper(managed->define_, static_cast<bind::meta::ClassDefine*>(data1)))
-                [[unlikely]] {
-                throw JsException{JsException::Type::TypeError, "This object is not a valid instance of this class."};
-            }
-            const_cast<Arguments&>(args).managed_ = managed; // for Arguments::getJsManagedResource
-
-            // lhs.$equals(rhs): boolean; lhs == rhs
-            if (args.length_ != 1) [[unlikely]] {
-                throw JsException{JsException::Type::TypeError, "$equals() takes exactly one argument."};
-            }
-
-            auto rhs = args[0];
-            if (!rhs.isObject() || !args.engine_->isInstanceOf(rhs.asObject(), *managed->define_)) {
-                return Boolean{false};
-            }
-
-            auto rhsInstance = args.engine_->getNativeInstanceOf(rhs.asObject(), *managed->define_);
-
-            bool const val = (*managed->define_->instanceMemberDef_.equals_)(instance, rhsInstance);
-            return Boolean{val};
-        })
-    );
-#endif // QJSPP_DONT_GENERATE_HELPER_EQLAUS_METHDO
-
-    for (auto&& method : def.instanceMemberDef_.methods_) {
-        auto fn = FunctionFactory::create(
+        FunctionFactory::create(
             engine_,
-            const_cast<bind::meta::InstanceMemberDefine::Method*>(&method),
             definePtr,
-            [](Arguments const& args, void* data1, void* data2) -> Value {
+            nullptr,
+            [](Arguments const& args, void* data1, void*) -> Value {
                 auto const classID = JS_GetClassID(args.thiz_);
                 assert(classID != JS_INVALID_CLASS_ID);
 
-                auto managed  = static_cast<bind::JsManagedResource*>(JS_GetOpaque(args.thiz_, classID));
-                auto instance = (*managed)();
+                auto managed = static_cast<bind::JsManagedResource*>(JS_GetOpaque(args.thiz_, classID));
+
+                bind::JsManagedResource::Pin pin{*managed}; // weak_ptr 资源在本次调用期间保持存活
+                auto                         instance = managed->get();
                 if (instance == nullptr) [[unlikely]] {
-                    throw JsException{JsException::Type::ReferenceError, "object is no longer available"};
+                    return JsException::raise(JsException::Type::ReferenceError, "object is no longer available");
                 }
                 if (kInstanceCallCheckClassDefine
-                    && !ClassDefineCheckHelper(managed->define_, static_cast<bind::meta::ClassDefine*>(data2)))
+                    && !ClassDefineCheckHelper(managed->define_, static_cast<bind::meta::ClassDefine*>(data1)))
                     [[unlikely]] {
-                    throw JsException{
+                    return JsException::raise(
                         JsException::Type::TypeError,
                         "This object is not a valid instance of this class."
-                    };
+                    );
                 }
                 const_cast<Arguments&>(args).managed_ = managed; // for Arguments::getJsManagedResource
 
-                auto method = static_cast<bind::meta::InstanceMemberDefine::Method*>(data1);
-                return (method->callback_)(instance, args);
-            }
+                // lhs.$equals(rhs): boolean; lhs == rhs
+                if (args.length_ != 1) [[unlikely]] {
+                    return JsException::raise(JsException::Type::TypeError, "$equals() takes exactly one argument.");
+                }
+
+                auto rhs = args[0];
+                if (!rhs.isObject() || !args.engine_->isInstanceOf(rhs.asObject(), *managed->define_)) {
+                    return Boolean{false};
+                }
+
+                auto rhsInstance = args.engine_->getNativeInstanceOf(rhs.asObject(), *managed->define_);
+
+                bool const val = (*managed->define_->instanceMemberDef_.equals_)(instance, rhsInstance);
+                return Boolean{val};
+            },
+            BindingKind::Method,
+            def.name_,
+            "$equals"
+        )
+    );
+#endif // QJSPP_DONT_GENERATE_HELPER_EQLAUS_METHDO
+
+    for (auto&& method : def.instanceMemberDef_.methods_) {
+        auto fn = FunctionFactory::create(
+            engine_,
+            const_cast<bind::meta::InstanceMemberDefine::Method*>(&method),
+            definePtr,
+            [](Arguments const& args, void* data1, void* data2) -> Value {
+                return _invokeInstanceMember(args, data2, [&](void* instance) -> Value {
+                    auto method = static_cast<bind::meta::InstanceMemberDefine::Method*>(data1);
+                    return (method->callback_)(instance, args);
+                });
+            },
+            BindingKind::Method,
+            def.name_,
+            method.name_
         );
         prototype.set(method.name_, fn);
     }
@@ -315,27 +493,14 @@ Object BindRegistry::_buildClassPrototype(bind::meta::ClassDefine const& def) co
             const_cast<bind::meta::InstanceMemberDefine::Property*>(&prop),
             definePtr,
             [](Arguments const& args, void* data1, void* data2) -> Value {
-                auto const classID = JS_GetClassID(args.thiz_);
-                assert(classID != JS_INVALID_CLASS_ID);
-
-                auto managed  = static_cast<bind::JsManagedResource*>(JS_GetOpaque(args.thiz_, classID));
-                auto instance = (*managed)();
-                if (instance == nullptr) [[unlikely]] {
-                    throw JsException{JsException::Type::ReferenceError, "object is no longer available"};
-                }
-                if (kInstanceCallCheckClassDefine
-                    && !ClassDefineCheckHelper(managed->define_, static_cast<bind::meta::ClassDefine*>(data2)))
-                    [[unlikely]] {
-                    throw JsException{
-                        JsException::Type::TypeError,
-                        "This object is not a valid instance of this class."
-                    };
-                }
-                const_cast<Arguments&>(args).managed_ = managed; // for Arguments::getJsManagedResource
-
-                auto property = static_cast<bind::meta::InstanceMemberDefine::Property*>(data1);
-                return (property->getter_)(instance, args);
-            }
+                return _invokeInstanceMember(args, data2, [&](void* instance) -> Value {
+                    auto property = static_cast<bind::meta::InstanceMemberDefine::Property*>(data1);
+                    return (property->getter_)(instance, args);
+                });
+            },
+            BindingKind::Getter,
+            def.name_,
+            prop.name_
         );
 
         if (prop.setter_) {
@@ -344,28 +509,15 @@ Object BindRegistry::_buildClassPrototype(bind::meta::ClassDefine const& def) co
                 const_cast<bind::meta::InstanceMemberDefine::Property*>(&prop),
                 definePtr,
                 [](Arguments const& args, void* data1, void* data2) -> Value {
-                    auto const classID = JS_GetClassID(args.thiz_);
-                    assert(classID != JS_INVALID_CLASS_ID);
-
-                    auto managed  = static_cast<bind::JsManagedResource*>(JS_GetOpaque(args.thiz_, classID));
-                    auto instance = (*managed)();
-                    if (instance == nullptr) [[unlikely]] {
-                        throw JsException{JsException::Type::ReferenceError, "object is no longer available"};
-                    }
-                    if (kInstanceCallCheckClassDefine
-                        && !ClassDefineCheckHelper(managed->define_, static_cast<bind::meta::ClassDefine*>(data2)))
-                        [[unlikely]] {
-                        throw JsException{
-                            JsException::Type::TypeError,
-                            "This object is not a valid instance of this class."
-                        };
-                    }
-                    const_cast<Arguments&>(args).managed_ = managed; // for Arguments::getJsManagedResource
-
-                    auto property = static_cast<bind::meta::InstanceMemberDefine::Property*>(data1);
-                    (property->setter_)(instance, args);
-                    return {}; // undefined
-                }
+                    return _invokeInstanceMember(args, data2, [&](void* instance) -> Value {
+                        auto property = static_cast<bind::meta::InstanceMemberDefine::Property*>(data1);
+                        (property->setter_)(instance, args);
+                        return {}; // undefined
+                    });
+                },
+                BindingKind::Setter,
+                def.name_,
+                prop.name_
             );
         }
 
@@ -381,10 +533,13 @@ Object BindRegistry::_buildClassPrototype(bind::meta::ClassDefine const& def) co
         JS_FreeAtom(engine_.context_, atom);
         JsException::check(ret);
     }
+
+    _buildMemberTable(def, prototype, true);
     return prototype;
 }
 
-void BindRegistry::_buildClassStatic(bind::meta::StaticMemberDefine const& def, Object& ctor) const {
+void BindRegistry::_buildClassStatic(bind::meta::ClassDefine const& classDef, Object& ctor) const {
+    auto const& def = classDef.staticMemberDef_;
     for (auto&& fnDef : def.functions_) {
         auto fn = FunctionFactory::create(
             engine_,
@@ -393,7 +548,10 @@ void BindRegistry::_buildClassStatic(bind::meta::StaticMemberDefine const& def,
             [](Arguments const& args, void* data1, void*) -> Value {
                 auto function = static_cast<bind::meta::StaticMemberDefine::Function*>(data1);
                 return (function->callback_)(args);
-            }
+            },
+            BindingKind::Function,
+            classDef.name_,
+            fnDef.name_
         );
         ctor.set(fnDef.name_, fn);
     }
@@ -409,7 +567,10 @@ void BindRegistry::_buildClassStatic(bind::meta::StaticMemberDefine const& def,
             [](Arguments const&, void* data1, void*) -> Value {
                 auto property = static_cast<bind::meta::StaticMemberDefine::Property*>(data1);
                 return (property->getter_)();
-            }
+            },
+            BindingKind::Getter,
+            classDef.name_,
+            propDef.name_
         );
         if (propDef.setter_) {
             setter = FunctionFactory::create(
@@ -418,9 +579,12 @@ void BindRegistry::_buildClassStatic(bind::meta::StaticMemberDefine const& def,
                 nullptr,
                 [](Arguments const& args, void* data1, void*) -> Value {
                     auto property = static_cast<bind::meta::StaticMemberDefine::Property*>(data1);
-                    (property->setter_)(args[0]);
+                    (property->setter_)(args.at(0));
                     return {};
-                }
+                },
+                BindingKind::Setter,
+                classDef.name_,
+                propDef.name_
             );
         }
 
@@ -436,6 +600,72 @@ void BindRegistry::_buildClassStatic(bind::meta::StaticMemberDefine const& def,
         JS_FreeAtom(engine_.context_, atom);
         JsException::check(ret);
     }
+
+    _buildMemberTable(classDef, ctor, false);
+}
+
+void BindRegistry::_buildMemberTable(bind::meta::ClassDefine const& def, Object& target, bool instance) const {
+    using Entry = bind::meta::MemberEntry;
+
+    // 表项为常量，直接作为函数的 opaque 数据，不复制名称与回调
+    FunctionFactory::RawFunctionData call;
+    FunctionFactory::RawFunctionData set;
+    if (instance) {
+        call = [](Arguments const& args, void* data1, void* data2) -> Value {
+            return _invokeInstanceMember(args, data2, [&](void* inst) -> Value {
+                return static_cast<Entry*>(data1)->callback_(inst, args);
+            });
+        };
+        set = [](Arguments const& args, void* data1, void* data2) -> Value {
+            return _invokeInstanceMember(args, data2, [&](void* inst) -> Value {
+                static_cast<Entry*>(data1)->setter_(inst, args);
+                return {}; // undefined
+            });
+        };
+    } else {
+        call = [](Arguments const& args, void* data1, void*) -> Value {
+            return static_cast<Entry*>(data1)->callback_(nullptr, args);
+        };
+        set = [](Arguments const& args, void* data1, void*) -> Value {
+            static_cast<Entry*>(data1)->setter_(nullptr, args);
+            return {};
+        };
+    }
+
+    auto definePtr = const_cast<bind::meta::ClassDefine*>(&def);
+    for (auto&& entry : def.memberTable_) {
+        if (entry.isInstance() != instance) continue;
+        auto data = const_cast<Entry*>(&entry);
+
+        if (entry.kind_ == Entry::Kind::Function || entry.kind_ == Entry::Kind::InstanceMethod) {
+            auto kind = instance ? BindingKind::Method : BindingKind::Function;
+            target.set(
+                entry.name_,
+                FunctionFactory::create(engine_, data, definePtr, call, kind, def.name_, entry.name_)
+            );
+            continue;
+        }
+
+        Value getter =
+            FunctionFactory::create(engine_, data, definePtr, call, BindingKind::Getter, def.name_, entry.name_);
+        Value setter;
+        if (entry.setter_) {
+            setter =
+                FunctionFactory::create(engine_, data, definePtr, set, BindingKind::Setter, def.name_, entry.name_);
+        }
+
+        auto atom = JS_NewAtomLen(engine_.context_, entry.name_.data(), entry.name_.size());
+        auto ret  = JS_DefinePropertyGetSet(
+            engine_.context_,
+            Value::extract(target),
+            atom,
+            JS_DupValue(engine_.context_, Value::extract(getter)),
+            JS_DupValue(engine_.context_, Value::extract(setter)),
+            toQuickJSFlags(PropertyAttributes::DontDelete)
+        );
+        JS_FreeAtom(engine_.context_, atom);
+        JsException::check(ret);
+    }
 }
 
 void BindRegistry::_buildModuleExports(bind::meta::ModuleDefine const& def, JSModuleDef* m) {
@@ -455,7 +685,10 @@ void BindRegistry::_buildModuleExports(bind::meta::ModuleDefine const& def, JSMo
             [](Arguments const& args, void* data1, void*) -> Value {
                 auto function = static_cast<bind::meta::ModuleDefine::FunctionExport*>(data1);
                 return (function->callback_)(args);
-            }
+            },
+            BindingKind::Function,
+            def.name_,
+            fn.name_
         );
         cache.functions_.emplace(&fn, std::move(fnVal));
     }
@@ -473,6 +706,20 @@ void BindRegistry::kInstanceClassFinalizer(JSRuntime*, JSValue val) {
         assert(managed->define_->instanceMemberDef_.classId_ == classID); // 校验类ID是否匹配
         auto engine = const_cast<JsEngine*>(managed->engine_);
 
+        if (managed->identityKey_ && engine->bindRegistry_) { // 引擎析构时 BindRegistry 先于运行时释放
+            auto& cache = engine->bindRegistry_->identityCache_[managed->define_];
+            if (auto iter = cache.find(managed->identityKey_);
+                iter != cache.end() && JS_VALUE_GET_PTR(iter->second) == JS_VALUE_GET_PTR(val)) {
+                cache.erase(iter);
+            }
+        }
+
+        if (!engine->isDestroying_ && engine->finalizeQueue_) {
+            // 原生析构延迟到 GC 结束后批量执行 (JsEngine::drainFinalizeQueue)
+            engine->finalizeQueue_->push(managed);
+            return;
+        }
+
         JsEngine::PauseGc pauseGc(engine); // 暂停GC
         Locker            lock(engine);    // 同步线程析构
         delete managed;
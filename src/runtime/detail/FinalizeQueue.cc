@@ -0,0 +1,117 @@
+#include "qjspp/runtime/detail/FinalizeQueue.hpp"
+#include "qjspp/bind/JsManagedResource.hpp"
+#include "qjspp/bind/meta/ClassDefine.hpp"
+
+#include <cassert>
+
+
+namespace qjspp::detail {
+
+
+FinalizeQueue::~FinalizeQueue() {
+    if (worker_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stopping_ = true;
+        }
+        cv_.notify_one();
+        worker_.join();
+    }
+    assert(pending_.empty() && background_.empty() && finished_.empty()); // 应由 shutdown() 清空
+}
+
+void FinalizeQueue::push(bind::JsManagedResource* managed) {
+    // 持有 JavaScript 值的控制块 (如 newInstanceOfView 的 owner) 必须在引擎线程析构
+    if (managed->define_ && managed->define_->threadSafeDestructible_ && !managed->engineBound_
+        && managed->finalizer_ != nullptr) {
+        background_.push_back(managed);
+    } else {
+        pending_.push_back(managed);
+    }
+}
+
+void FinalizeQueue::drain() {
+    if (draining_) return;
+    draining_ = true;
+
+    std::vector<bind::JsManagedResource*> batch;
+    if (hasFinished_) {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            batch.swap(finished_);
+            hasFinished_ = false;
+        }
+        destroy(batch); // 实例已在后台线程析构，仅归还内存
+    }
+
+    while (!pending_.empty() || !background_.empty()) {
+        if (!background_.empty()) {
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                inbox_.insert(inbox_.end(), background_.begin(), background_.end());
+            }
+            background_.clear();
+            if (!worker_.joinable()) {
+                worker_ = std::thread{&FinalizeQueue::workerLoop, this};
+            }
+            cv_.notify_one();
+        }
+        // 析构过程中释放的包装对象会再次入队，交换后逐批处理
+        batch.swap(pending_);
+        destroy(batch);
+    }
+
+    draining_ = false;
+}
+
+void FinalizeQueue::shutdown() {
+    if (worker_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stopping_ = true;
+        }
+        cv_.notify_one();
+        worker_.join();
+    }
+
+    // 后台线程已退出，剩余资源全部在当前线程析构
+    pending_.insert(pending_.end(), background_.begin(), background_.end());
+    pending_.insert(pending_.end(), finished_.begin(), finished_.end());
+    background_.clear();
+    finished_.clear();
+    hasFinished_ = false;
+
+    std::vector<bind::JsManagedResource*> batch;
+    while (!pending_.empty()) {
+        batch.swap(pending_);
+        destroy(batch);
+    }
+}
+
+void FinalizeQueue::workerLoop() {
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (true) {
+        cv_.wait(lock, [this] { return stopping_ || !inbox_.empty(); });
+        if (inbox_.empty()) break; // stopping_
+
+        auto batch = std::move(inbox_);
+        inbox_.clear();
+        lock.unlock();
+        for (auto managed : batch) {
+            managed->finalize(); // 仅析构实例，内存由引擎线程归还 (资源池非线程安全)
+        }
+        lock.lock();
+        finished_.insert(finished_.end(), batch.begin(), batch.end());
+        hasFinished_ = true;
+    }
+}
+
+void FinalizeQueue::destroy(std::vector<bind::JsManagedResource*>& batch) {
+    for (auto managed : batch) {
+        delete managed;
+    }
+    batch.clear();
+}
+
+
+} // namespace qjspp::detail
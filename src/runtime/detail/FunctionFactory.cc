@@ -10,14 +10,28 @@
 namespace qjspp::detail {
 
 
-Function FunctionFactory::create(JsEngine& engine, void* data1, void* data2, RawFunctionData rawFn) {
+Function FunctionFactory::create(
+    JsEngine&        engine,
+    void*            data1,
+    void*            data2,
+    RawFunctionData  rawFn,
+    BindingKind      kind,
+    std::string_view scope,
+    std::string_view member
+) {
     auto context = engine.context_;
 
     auto op1   = newOpaque(engine, data1);
     auto op2   = newOpaque(engine, data2);
     auto anyCb = newOpaque(engine, reinterpret_cast<void*>(rawFn));
 
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+    auto profile = newOpaque(engine, engine.profiler_->entry(scope, member, kind));
+
+    std::array<JSValue, 4> dataArray{op1, op2, anyCb, profile};
+#else
     std::array<JSValue, 3> dataArray{op1, op2, anyCb};
+#endif
 
     auto fn = JS_NewCFunctionData(
         context,
@@ -28,11 +42,26 @@ Function FunctionFactory::create(JsEngine& engine, void* data1, void* data2, Raw
             auto data2    = JS_GetOpaque(data[1], engine->kPointerClassId);
             auto callback = reinterpret_cast<RawFunctionData>(JS_GetOpaque(data[2], engine->kPointerClassId));
 
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+            auto profile = BindingProfiler::CallScope{
+                *engine->profiler_,
+                static_cast<BindingProfiler::Entry*>(JS_GetOpaque(data[3], engine->kPointerClassId))
+            };
+#endif
+
             try {
                 auto arguments = Arguments{engine, thiz, argc, argv};
                 auto ret       = callback(arguments, data1, data2);
-                return JS_DupValue(ctx, Value::extract(ret));
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+                if (ret.isException()) [[unlikely]] {
+                    profile.markException(); // JsException::raise
+                }
+#endif
+                return JS_DupValue(ctx, Value::extract(ret)); // JS_EXCEPTION 原样返回
             } catch (JsException const& e) {
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+                profile.markException();
+#endif
                 return e.rethrowToEngine();
             }
         },
@@ -45,9 +74,42 @@ Function FunctionFactory::create(JsEngine& engine, void* data1, void* data2, Raw
     JS_FreeValue(context, op1);
     JS_FreeValue(context, op2);
     JS_FreeValue(context, anyCb);
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+    JS_FreeValue(context, profile);
+#endif
 
     JsException::check(fn);
-    return Value::move<Function>(fn);
+
+    auto function = Value::move<Function>(fn);
+    switch (kind) {
+    case BindingKind::Constructor:
+        setName(engine, fn, scope);
+        break;
+    case BindingKind::Getter:
+        if (!member.empty()) setName(engine, fn, std::format("get {}", member));
+        break;
+    case BindingKind::Setter:
+        if (!member.empty()) setName(engine, fn, std::format("set {}", member));
+        break;
+    default:
+        setName(engine, fn, member);
+        break;
+    }
+    return function;
+}
+
+void FunctionFactory::setName(JsEngine& engine, JSValue fn, std::string_view name) {
+    if (name.empty()) return;
+    auto nameAtom = JS_NewAtom(engine.context_, "name");
+    auto ret      = JS_DefinePropertyValue(
+        engine.context_,
+        fn,
+        nameAtom,
+        JS_NewStringLen(engine.context_, name.data(), name.size()),
+        JS_PROP_CONFIGURABLE
+    );
+    JS_FreeAtom(engine.context_, nameAtom);
+    JsException::check(ret);
 }
 
 JSValue FunctionFactory::newOpaque(JsEngine& engine, void* data) {
@@ -0,0 +1,35 @@
+#pragma once
+#include <format>
+#include <string>
+#include <string_view>
+
+namespace qjspp::detail {
+
+
+// 以 JSON 字符串字面量形式追加 str (带引号并转义)，供各性能分析器导出报告使用
+inline void appendJsonString(std::string& out, std::string_view str) {
+    out.push_back('"');
+    for (char c : str) {
+        switch (c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out += std::format("\\u{:04x}", static_cast<int>(c));
+            } else {
+                out.push_back(c);
+            }
+        }
+    }
+    out.push_back('"');
+}
+
+
+} // namespace qjspp::detail
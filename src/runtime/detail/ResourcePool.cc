@@ -0,0 +1,60 @@
+#include "qjspp/runtime/detail/ResourcePool.hpp"
+
+#include <algorithm>
+
+
+namespace qjspp::detail {
+
+
+ResourcePool::ResourcePool(size_t blockSize, size_t blocksPerChunk)
+: blockSize_(std::max(blockSize, sizeof(FreeNode))),
+  blocksPerChunk_(std::max<size_t>(blocksPerChunk, 1)) {
+    // 块首地址需满足 max_align_t 对齐 (new std::byte[] 的返回值已对齐)
+    blockSize_ = (blockSize_ + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+ResourcePool::~ResourcePool() {
+    if (inUse_ != 0) {
+        for (auto& chunk : chunks_) {
+            (void)chunk.release(); // 仍有外部引用，放弃释放
+        }
+    }
+}
+
+void* ResourcePool::allocate() {
+    if (!freeList_) [[unlikely]] {
+        grow();
+    }
+    auto node = freeList_;
+    freeList_ = node->next_;
+    ++inUse_;
+    return node;
+}
+
+void ResourcePool::deallocate(void* block) noexcept {
+    if (!block) return;
+    auto node   = static_cast<FreeNode*>(block);
+    node->next_ = freeList_;
+    freeList_   = node;
+    --inUse_;
+}
+
+size_t ResourcePool::blockSize() const { return blockSize_; }
+
+size_t ResourcePool::inUse() const { return inUse_; }
+
+size_t ResourcePool::capacity() const { return chunks_.size() * blocksPerChunk_; }
+
+void ResourcePool::grow() {
+    auto chunk = std::make_unique_for_overwrite<std::byte[]>(blockSize_ * blocksPerChunk_);
+    auto base  = chunk.get();
+    for (size_t i = blocksPerChunk_; i-- > 0;) {
+        auto node   = reinterpret_cast<FreeNode*>(base + i * blockSize_);
+        node->next_ = freeList_;
+        freeList_   = node;
+    }
+    chunks_.push_back(std::move(chunk));
+}
+
+
+} // namespace qjspp::detail
@@ -3,6 +3,7 @@
 #include "qjspp/bind/JsManagedResource.hpp"
 #include "qjspp/types/Object.hpp"
 #include "qjspp/types/Value.hpp"
+#include "qjspp/types/ValueRef.hpp"
 
 namespace qjspp {
 
@@ -30,4 +31,11 @@ Value Arguments::operator[](size_t index) const {
     return Value::wrap<Value>(args_[index]);
 }
 
+ValueRef Arguments::at(size_t index) const {
+    if (index >= length_) {
+        return ValueRef{}; // undefined
+    }
+    return ValueRef{args_[index]};
+}
+
 } // namespace qjspp
\ No newline at end of file
@@ -3,17 +3,19 @@
 #include "qjspp/runtime/JsEngine.hpp"
 #include "qjspp/runtime/JsException.hpp"
 #include "qjspp/runtime/Locker.hpp"
+#include "qjspp/runtime/detail/FunctionFactory.hpp"
 #include "qjspp/types/Arguments.hpp"
 #include "qjspp/types/String.hpp"
 #include "qjspp/types/Value.hpp"
 
 #include <cassert>
+#include <iterator>
 #include <memory>
 
 namespace qjspp {
 
 IMPL_QJSPP_DEFINE_VALUE_COMMON(Function);
-Function::Function(FunctionCallback callback) {
+Function::Function(FunctionCallback callback, std::string_view name) {
     auto ptr = std::make_unique<FunctionCallback>(std::move(callback));
 
     auto& engine = Locker::currentEngineChecked();
@@ -22,7 +24,18 @@ Function::Function(FunctionCallback callback) {
     JsException::check(fnData);
     JS_SetOpaque(fnData, ptr.release());
 
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+    auto profile = JS_NewObjectClass(engine.context_, static_cast<int>(engine.kPointerClassId));
+    JsException::check(profile);
+    JS_SetOpaque(
+        profile,
+        engine.profiler_->entry("", name.empty() ? "<anonymous>" : name, BindingKind::Function)
+    );
+
+    JSValue data[2] = {fnData, profile};
+#else
     JSValue data[1] = {fnData};
+#endif
 
     auto fn = JS_NewCFunctionData(
         engine.context_,
@@ -34,21 +47,41 @@ Function::Function(FunctionCallback callback) {
             auto engine = static_cast<JsEngine*>(JS_GetContextOpaque(ctx));
             assert(kFuncID == engine->kFunctionDataClassId);
 
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+            auto profile = BindingProfiler::CallScope{
+                *engine->profiler_,
+                static_cast<BindingProfiler::Entry*>(JS_GetOpaque(data[1], engine->kPointerClassId))
+            };
+#endif
+
             try {
                 auto result = (*cb)(Arguments{engine, thiz, argc, argv});
-                return JS_DupValue(ctx, Value::extract(result));
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+                if (result.isException()) [[unlikely]] {
+                    profile.markException(); // JsException::raise
+                }
+#endif
+                return JS_DupValue(ctx, Value::extract(result)); // JS_EXCEPTION 原样返回
             } catch (JsException const& e) {
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+                profile.markException();
+#endif
                 return e.rethrowToEngine();
             }
         },
         0,
         0,
-        1,
+        static_cast<int>(std::size(data)),
         data
     );
-    JsException::check(fn);
     JS_FreeValue(engine.context_, fnData);
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+    JS_FreeValue(engine.context_, profile);
+#endif
+    JsException::check(fn);
     val_ = fn;
+
+    detail::FunctionFactory::setName(engine, val_, name);
 }
 
 Function Function::newFunction(FunctionCallback&& callback) { return Function{std::move(callback)}; }
@@ -59,6 +92,8 @@ Value Function::callImpl(Value const& thiz, int argc, Value const* argv) const {
     static_assert(sizeof(Value) == sizeof(JSValue), "Value and JSValue must have the same size");
     auto* argv_ = reinterpret_cast<JSValue*>(const_cast<Value*>(argv)); // fast
 
+    JsEngine::ExecutionScope execution(&engine);
+
     auto ret = JS_Call(engine.context_, val_, thiz.isObject() ? Value::extract(thiz) : JS_UNDEFINED, argc, argv_);
     JsException::check(ret);
     engine.pumpJobs();
@@ -88,6 +123,8 @@ Value Function::callAsConstructor(std::vector<Value> const& args) const {
     static_assert(sizeof(Value) == sizeof(JSValue), "Value and JSValue must have the same size");
     auto* argv = reinterpret_cast<JSValue*>(const_cast<Value*>(args.data())); // fast
 
+    JsEngine::ExecutionScope execution(&engine);
+
     auto res = JS_CallConstructor(engine.context_, val_, static_cast<int>(args.size()), argv);
     JsException::check(res);
     engine.pumpJobs();
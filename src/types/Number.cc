@@ -5,30 +5,41 @@
 #include "qjspp/types/String.hpp"
 #include "qjspp/types/Value.hpp"
 
+#include <cstdint>
+#include <utility>
+
 namespace qjspp {
 
 IMPL_QJSPP_DEFINE_VALUE_COMMON(Number);
-Number::Number(double d) : val_(JS_NewFloat64(Locker::currentContextChecked(), d)) {}
+// JS_NewInt32 / JS_NewFloat64 为内联构造，不访问 JSContext，无需查询当前作用域
+Number::Number(double d) : val_(JS_NewFloat64(nullptr, d)) {}
 Number::Number(float f) : Number{static_cast<double>(f)} {}
-Number::Number(int i32) : val_(JS_NewInt32(Locker::currentContextChecked(), i32)) {}
-Number::Number(int64_t i64) : val_(JS_NewInt64(Locker::currentContextChecked(), i64)) {}
+Number::Number(int i32) : val_(JS_NewInt32(nullptr, i32)) {}
+Number::Number(int64_t i64)
+: val_(
+      std::in_range<int32_t>(i64) ? JS_NewInt32(nullptr, static_cast<int32_t>(i64))
+                                  : JS_NewFloat64(nullptr, static_cast<double>(i64))
+  ) {}
 
 float  Number::getFloat() const { return static_cast<float>(getDouble()); }
 double Number::getDouble() const {
+    if (JS_VALUE_GET_TAG(val_) == JS_TAG_INT) return JS_VALUE_GET_INT(val_);
+    if (JS_TAG_IS_FLOAT64(JS_VALUE_GET_TAG(val_))) return JS_VALUE_GET_FLOAT64(val_);
     double ret;
     JsException::check(JS_ToFloat64(Locker::currentContextChecked(), &ret, val_));
     return ret;
 }
 int Number::getInt32() const {
+    if (JS_VALUE_GET_TAG(val_) == JS_TAG_INT) return JS_VALUE_GET_INT(val_);
     int ret;
     JsException::check(JS_ToInt32(Locker::currentContextChecked(), &ret, val_));
     return ret;
 }
 int64_t Number::getInt64() const {
+    if (JS_VALUE_GET_TAG(val_) == JS_TAG_INT) return JS_VALUE_GET_INT(val_);
     int64_t ret;
     JsException::check(JS_ToInt64(Locker::currentContextChecked(), &ret, val_));
     return ret;
 }
 
-
 } // namespace qjspp
\ No newline at end of file
@@ -16,6 +16,8 @@ ScopedJsValue::ScopedJsValue(ScopedJsValue&& other) noexcept {
     val_    = std::move(other.val_);
 }
 ScopedJsValue& ScopedJsValue::operator=(ScopedJsValue&& other) noexcept {
+    if (this == &other) return *this;
+    reset();
     engine_ = other.engine_;
     val_    = std::move(other.val_);
     return *this;
@@ -28,8 +30,7 @@ ScopedJsValue& ScopedJsValue::operator=(ScopedJsValue const& copy) = default;
 ScopedJsValue::~ScopedJsValue() { reset(); }
 void ScopedJsValue::reset() {
     if (val_.isValid()) {
-        Locker lock{engine_};
-        val_.reset();
+        engine_->releaseValue(Value::release(std::move(val_))); // 非引擎线程不等待锁，入队延迟释放
     }
 }
 JsEngine* ScopedJsValue::engine() const { return engine_; }
@@ -51,6 +51,7 @@ bool Value::isString() const { return JS_IsString(val_); }
 bool Value::isObject() const { return JS_IsObject(val_); }
 bool Value::isArray() const { return JS_IsArray(val_); }
 bool Value::isFunction() const { return JS_IsFunction(Locker::currentContextChecked(), val_); }
+bool Value::isException() const { return JS_IsException(val_); }
 
 Undefined Value::asUndefined() const {
     if (!isUndefined()) throw JsException{JsException::Type::InternalError, "can't convert to Undefined"};
@@ -0,0 +1,32 @@
+#include "qjspp/types/ValueRef.hpp"
+
+#include <utility>
+
+namespace qjspp {
+
+// Value::move 仅接管 JSValue、Value::release 仅交出 JSValue，均不触碰引用计数
+ValueRef::ValueRef(JSValueConst value) : view_(Value::move<Value>(value)) {}
+ValueRef::ValueRef(Value const& value) : view_(Value::move<Value>(Value::extract(value))) {}
+
+ValueRef::ValueRef(ValueRef const& other) : view_(Value::move<Value>(Value::extract(other.view_))) {}
+ValueRef& ValueRef::operator=(ValueRef const& other) {
+    if (this != &other) {
+        (void)Value::release(std::move(view_)); // 先交出旧的借用，避免赋值时释放不属于自己的引用
+        view_ = Value::move<Value>(Value::extract(other.view_));
+    }
+    return *this;
+}
+
+ValueRef::~ValueRef() { (void)Value::release(std::move(view_)); }
+
+Value const& ValueRef::value() const { return view_; }
+
+Value const* ValueRef::operator->() const { return &view_; }
+
+ValueRef::operator Value const&() const { return view_; }
+
+Value ValueRef::toValue() const { return Value::wrap<Value>(Value::extract(view_)); }
+
+JSValueConst ValueRef::raw() const { return Value::extract(view_); }
+
+} // namespace qjspp
\ No newline at end of file
@@ -8,11 +8,19 @@
 #include "qjspp/bind/builder/ModuleDefineBuilder.hpp"
 #include "qjspp/runtime/JsEngine.hpp"
 #include "qjspp/runtime/Locker.hpp"
+#include "qjspp/runtime/detail/FinalizeQueue.hpp"
+#include "qjspp/types/JsCallback.hpp"
+#include "qjspp/types/ScopedJsValue.hpp"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <iostream>
+#include <optional>
 #include <sstream>
+#include <thread>
 #include <utility>
+#include <vector>
 
 
 qjspp::Value JsAssert(qjspp::Arguments const& args) {
@@ -99,6 +107,43 @@ TEST_CASE_METHOD(TestEngineFixture, "Static Binding") {
     REQUIRE(Util::cus == "new");
 }
 
+TEST_CASE_METHOD(TestEngineFixture, "Binding Error Fast Path") {
+    qjspp::Locker scope{engine_};
+    engine_->registerClass(UtilDefine);
+
+    // 参数校验错误直接抛入引擎，JS 侧可捕获为 TypeError
+    REQUIRE(
+        engine_
+            ->eval(R"(
+                let r = [];
+                for (const f of [() => Util.add(1), () => Util.add('a', 2), () => Util.append(1, 2)]) {
+                    try { f(); } catch (e) { r.push(`${e instanceof TypeError}:${e.message}`); }
+                }
+                r.join('|');
+            )")
+            .asString()
+            .value()
+        == "true:argument count mismatch|true:argument type mismatch|true:no overload found"
+    );
+
+    REQUIRE_THROWS_MATCHES(
+        engine_->eval("Util.add(1)"),
+        qjspp::JsException,
+        Catch::Matchers::Message("argument count mismatch")
+    );
+
+    auto raise = qjspp::Function{[](qjspp::Arguments const& args) -> qjspp::Value {
+        if (args.length() != 1) {
+            return qjspp::JsException::raise(qjspp::JsException::Type::RangeError, "expected 1 argument");
+        }
+        return args[0];
+    }};
+    engine_->globalThis().set("raise", raise);
+    REQUIRE(engine_->eval("raise(7)").asNumber().getInt32() == 7);
+    REQUIRE(engine_->eval("try { raise() } catch (e) { e instanceof RangeError }").asBoolean().value());
+    REQUIRE_THROWS_MATCHES(raise.call(), qjspp::JsException, Catch::Matchers::Message("expected 1 argument"));
+}
+
 
 // Instance binding
 class Base {
@@ -200,6 +245,8 @@ TEST_CASE_METHOD(TestEngineFixture, "Instance Binding") {
         auto der = engine_->eval("getDerived()");
         REQUIRE(der.isObject());
         REQUIRE(engine_->eval("getDerived().derivedMember").asNumber().getInt32() == 888);
+        REQUIRE(engine_->eval("getDerived() instanceof Derived && getDerived() instanceof Base").asBoolean().value());
+        REQUIRE(engine_->eval("getDerived().type()").asString().value() == "Derived");
     }
 
     SECTION("JavaSceipt inherit") {
@@ -213,6 +260,8 @@ TEST_CASE_METHOD(TestEngineFixture, "Instance Binding") {
             debug(`baseMember: ${my.baseMember}`);
             debug(`baseBar: ${my.baseBar()}`);
         )"));
+        // 派生类以 new.target.prototype 为原型，不使用缓存的原生类原型
+        REQUIRE(engine_->eval("my instanceof MyDerived && my instanceof Derived").asBoolean().value());
     }
 
     SECTION("$equals") {
@@ -285,6 +334,8 @@ public:
 
     void setCallback(Callback cb) { cb_ = std::move(cb); }
 
+    Callback getCallback() const { return cb_; }
+
     void call(int val) {
         if (cb_) {
             cb_(val);
@@ -296,6 +347,7 @@ public:
 qjspp::bind::meta::ClassDefine TestFormDefine = qjspp::bind::defineClass<TestForm>("TestForm")
                                                     .constructor<>()
                                                     .instanceMethod("setCallback", &TestForm::setCallback)
+                                                    .instanceMethod("getCallback", &TestForm::getCallback)
                                                     .instanceMethod("call", &TestForm::call)
                                                     .build();
 
@@ -305,15 +357,67 @@ TEST_CASE_METHOD(TestEngineFixture, "Test Callback") {
     engine_->registerClass(TestFormDefine);
     engine_->globalThis().set("assert", qjspp::Function{&JsAssert});
 
+    std::function<int(int, int)> mul = [](int a, int b) { return a * b; };
+    engine_->globalThis().set("mul", qjspp::bind::ConvertToJs(mul)); // std::function -> Function
+
     engine_->eval(R"(
+        assert(mul(6, 7) == 42);
+
         let fm = new TestForm();
+        assert(fm.getCallback() === null);
+
+        let received = 0;
         fm.setCallback((val) => {
             assert(val == 114514);
+            received++;
         });
         fm.call(114514);
+        assert(received == 1);
+
+        let fn = (val) => received++;
+        fm.setCallback(fn);
+        assert(fm.getCallback() === fn); // 脚本函数原样返回
     )");
 }
 
+TEST_CASE_METHOD(TestEngineFixture, "Test JsCallback") {
+    qjspp::JsCallback<int(int, int)> add;
+    {
+        qjspp::Locker scope{engine_};
+
+        auto thiz = engine_->eval("({ base: 100, add(a, b) { return this.base + a + b; } })").asObject();
+        add       = qjspp::JsCallback<int(int, int)>{thiz.get("add").asFunction(), thiz};
+        REQUIRE(add.isAlive());
+        REQUIRE(add(1, 2) == 103); // 已在引擎作用域内，不再创建 Locker
+
+        auto copy = add;
+        REQUIRE(copy.receiver() == thiz);
+
+        // 绑定了 receiver 的回调转换回 JavaScript 时保留 this
+        engine_->globalThis().set("boundAdd", qjspp::bind::ConvertToJs(std::function<int(int, int)>{add}));
+        REQUIRE(engine_->eval("boundAdd(1, 2)").asNumber().getInt32() == 103);
+        engine_->globalThis().set("boundAdd", qjspp::bind::ConvertToJs(add));
+        REQUIRE(engine_->eval("boundAdd(1, 2)").asNumber().getInt32() == 103);
+    }
+    REQUIRE(add(3, 4) == 107); // 作用域外临时加锁
+
+    {
+        auto engine = new qjspp::JsEngine();
+
+        qjspp::JsCallback<void()> cb;
+        {
+            qjspp::Locker scope{engine};
+            cb = qjspp::JsCallback<void()>{engine->eval("(() => {})").asFunction()};
+        }
+        REQUIRE(cb.isAlive());
+        REQUIRE_NOTHROW(cb());
+
+        delete engine;
+        REQUIRE_FALSE(cb.isAlive());
+        REQUIRE_THROWS_AS(cb(), qjspp::JsException);
+    }
+}
+
 
 class AbstractFoo {
 public:
@@ -565,5 +669,528 @@ TEST_CASE_METHOD(TestEngineFixture, "Non-value type ref") {
 
         ab.min = new Vec3(1, 2, 3);
         assert(ab.min.$equals(mm), `${ab.min}/${mm}`);
+        assert(ab.min === mm && ab.max !== mm); // 成员包装对象按槽位缓存
     )"));
+
+    // 仅持有成员包装对象时 owner 不会被回收
+    REQUIRE_NOTHROW(engine_->eval("var orphan = new AABB(new Vec3(4, 5, 6), new Vec3()).min;"));
+    engine_->gc();
+    REQUIRE(engine_->eval("orphan.x + orphan.y + orphan.z").asNumber().getInt32() == 15);
+
+    // 不可扩展的 owner 回退为非缓存路径
+    REQUIRE_NOTHROW(engine_->eval(R"(
+        let frozen = Object.freeze(new AABB());
+        frozen.max.x = 7;
+        assert(frozen.max.x === 7);
+    )"));
+}
+
+TEST_CASE_METHOD(TestEngineFixture, "Inline Ownership Control") {
+    qjspp::Locker scope{engine_};
+    engine_->registerClass(ScriptVec3);
+
+    // shared_ptr / weak_ptr 控制块内联存放于 JsManagedResource，GC 时原地析构
+    auto shared = std::make_shared<Vec3>(1.0f, 2.0f, 3.0f);
+    {
+        auto strong = engine_->newInstanceOfShared(ScriptVec3, std::shared_ptr<Vec3>{shared});
+        auto weak   = engine_->newInstanceOfWeak(ScriptVec3, std::weak_ptr<Vec3>{shared});
+        REQUIRE(shared.use_count() == 2);
+        REQUIRE(engine_->getNativeInstanceOf<Vec3>(strong, ScriptVec3) == shared.get());
+        REQUIRE(engine_->getNativeInstanceOf<Vec3>(weak, ScriptVec3) == shared.get());
+    }
+    engine_->gc();
+    REQUIRE(shared.use_count() == 1);
+    REQUIRE(shared->x == 1.0f);
+}
+
+std::shared_ptr<Vec3> PinnedVec3;
+
+auto ScriptPinnedVec3 = qjspp::bind::defineClass<Vec3>("PinnedVec3")
+                            .constructor<>()
+                            .instanceProperty("x", &Vec3::x)
+                            .instanceMethod(
+                                "dropAndRead",
+                                [](void* inst, qjspp::Arguments const& args) -> qjspp::Value {
+                                    PinnedVec3.reset(); // 调用期间释放最后一个外部强引用
+                                    auto pinned = static_cast<Vec3*>(args.getJsManagedResource()->get());
+                                    return qjspp::Number{static_cast<Vec3*>(inst)->x + pinned->y};
+                                }
+                            )
+                            .build();
+
+TEST_CASE_METHOD(TestEngineFixture, "Weak Pin During Call") {
+    qjspp::Locker scope{engine_};
+    engine_->registerClass(ScriptPinnedVec3);
+
+    PinnedVec3 = std::make_shared<Vec3>(1.0f, 2.0f, 3.0f);
+    engine_->globalThis().set("pinned", engine_->newInstanceOfWeak(ScriptPinnedVec3, std::weak_ptr<Vec3>{PinnedVec3}));
+
+    // 实例在整个调用期间保持存活，调用结束后随 Pin 一同释放
+    REQUIRE(engine_->eval("pinned.dropAndRead()").asNumber().getFloat() == 3.0f);
+    REQUIRE(PinnedVec3 == nullptr);
+    REQUIRE_THROWS_AS(engine_->eval("pinned.x"), qjspp::JsException);
+}
+
+auto ScriptCachedVec3 = qjspp::bind::defineClass<Vec3>("CachedVec3")
+                            .constructor<>()
+                            .instanceProperty("x", &Vec3::x)
+                            .enableIdentityCache()
+                            .build();
+
+TEST_CASE_METHOD(TestEngineFixture, "Identity Cache") {
+    qjspp::Locker scope{engine_};
+    engine_->registerClass(ScriptCachedVec3);
+
+    Vec3 vec{1.0f, 2.0f, 3.0f};
+    {
+        auto first  = engine_->newInstanceOfView(ScriptCachedVec3, &vec);
+        auto second = engine_->newInstanceOfView(ScriptCachedVec3, &vec);
+        REQUIRE(first == second); // 同一原生指针复用同一包装对象
+
+        engine_->globalThis().set("cached", first);
+        REQUIRE(engine_->eval("cached").asObject() == second);
+        engine_->globalThis().remove("cached");
+    }
+    engine_->gc();
+
+    // 包装对象回收后缓存条目随 finalizer 清除，再次包装得到新的对象
+    auto third = engine_->newInstanceOfView(ScriptCachedVec3, &vec);
+    REQUIRE(engine_->getNativeInstanceOf<Vec3>(third, ScriptCachedVec3) == &vec);
+
+    // 脚本构造的实例同样登记
+    engine_->globalThis().set("make", qjspp::Function{[&](qjspp::Arguments const& args) -> qjspp::Value {
+        auto self = engine_->getNativeInstanceOf<Vec3>(args[0].asObject(), ScriptCachedVec3);
+        return engine_->newInstanceOfView(ScriptCachedVec3, self);
+    }});
+    REQUIRE(engine_->eval("let v = new CachedVec3(); make(v) === v").asBoolean().value());
+}
+
+class Handoff {
+public:
+    static inline int destroyed = 0;
+
+    int value{7};
+    ~Handoff() { ++destroyed; }
+};
+
+auto ScriptHandoff = qjspp::bind::defineClass<Handoff>("Handoff")
+                         .disableConstructor()
+                         .instanceProperty("value", &Handoff::value)
+                         .enableIdentityCache()
+                         .build();
+
+TEST_CASE_METHOD(TestEngineFixture, "Identity Cache Ownership Handoff") {
+    qjspp::Locker scope{engine_};
+    engine_->registerClass(ScriptHandoff);
+    Handoff::destroyed = 0;
+
+    // 先以 View 传入，再转交所有权：返回同一对象，实例不得提前析构
+    auto raw  = new Handoff{};
+    auto view = engine_->newInstanceOfView(ScriptHandoff, raw);
+    auto own  = engine_->newInstanceOfUnique(ScriptHandoff, std::unique_ptr<Handoff>{raw});
+    REQUIRE(view == own);
+    REQUIRE(Handoff::destroyed == 0);
+
+    engine_->globalThis().set("handoff", own);
+    REQUIRE(engine_->eval("handoff.value").asNumber().getInt32() == 7);
+
+    // 已持有实例时重复转交独占所有权：抛出异常，实例仍归原对象所有
+    REQUIRE_THROWS_AS(engine_->newInstanceOfRaw(ScriptHandoff, raw), std::logic_error);
+    REQUIRE(Handoff::destroyed == 0);
+    REQUIRE(engine_->eval("handoff.value").asNumber().getInt32() == 7);
+
+    // 视图重复传入不影响所有权
+    REQUIRE(engine_->newInstanceOfView(ScriptHandoff, raw) == own);
+
+    view.reset();
+    own.reset();
+    engine_->globalThis().remove("handoff");
+    engine_->gc();
+    REQUIRE(Handoff::destroyed == 1); // 由接管所有权的包装对象析构
+
+    // shared_ptr 重复传入：复用包装对象，多余的引用直接释放
+    auto shared = std::make_shared<Handoff>();
+    {
+        auto first  = engine_->newInstanceOfView(ScriptHandoff, shared.get());
+        auto second = engine_->newInstanceOfShared(ScriptHandoff, std::shared_ptr<Handoff>{shared});
+        auto third  = engine_->newInstanceOfShared(ScriptHandoff, std::shared_ptr<Handoff>{shared});
+        REQUIRE(first == second);
+        REQUIRE(second == third);
+        REQUIRE(shared.use_count() == 2);
+    }
+    engine_->gc();
+    REQUIRE(shared.use_count() == 1);
+    REQUIRE(Handoff::destroyed == 1);
+
+    // 持有 owner 的视图同样不持有实例，随后转交的所有权由其接管
+    Handoff::destroyed = 0;
+    {
+        auto owned = new Handoff{};
+        auto first = engine_->newInstanceOfView(ScriptHandoff, owned, qjspp::Object::newObject());
+        auto taken = engine_->newInstanceOfUnique(ScriptHandoff, std::unique_ptr<Handoff>{owned});
+        REQUIRE(first == taken);
+        REQUIRE(Handoff::destroyed == 0);
+    }
+    engine_->gc();
+    REQUIRE(Handoff::destroyed == 1);
+
+    // weak_ptr 包装对象接管 shared_ptr 后升级为强引用，外部引用释放后实例仍然存活
+    Handoff::destroyed = 0;
+    {
+        auto weakOnly = std::make_shared<Handoff>();
+        auto first    = engine_->newInstanceOfWeak(ScriptHandoff, std::weak_ptr<Handoff>{weakOnly});
+        auto strong   = engine_->newInstanceOfShared(ScriptHandoff, std::shared_ptr<Handoff>{weakOnly});
+        REQUIRE(first == strong);
+        REQUIRE(weakOnly.use_count() == 2);
+
+        weakOnly.reset();
+        REQUIRE(Handoff::destroyed == 0);
+        engine_->globalThis().set("upgraded", first);
+        REQUIRE(engine_->eval("upgraded.value").asNumber().getInt32() == 7);
+        engine_->globalThis().remove("upgraded");
+    }
+    engine_->gc();
+    REQUIRE(Handoff::destroyed == 1);
+}
+
+using Vec3Members = qjspp::bind::MemberOf<Vec3>;
+
+constexpr auto StaticVec3Members = qjspp::bind::defineMembers<Vec3>(
+    Vec3Members::instanceProperty<&Vec3::x>("x"),
+    Vec3Members::instanceProperty<&Vec3::y>("y"),
+    Vec3Members::instanceMethod<&Vec3::toString>("toString"),
+    Vec3Members::function<&Base::baseTrue>("baseTrue"),
+    Vec3Members::property<&Base::name>("baseName")
+);
+
+auto ScriptStaticVec3 =
+    qjspp::bind::defineClass<Vec3>("StaticVec3").constructor<float, float, float>().members(StaticVec3Members).build();
+
+using UtilMembers = qjspp::bind::MemberOf<void>;
+
+constexpr auto StaticUtilMembers = qjspp::bind::defineMembers<void>(
+    UtilMembers::function<&Util::add>("add"),
+    UtilMembers::property<&Util::foo>("foo"),
+    UtilMembers::property<&Util::bar>("bar")
+);
+
+auto ScriptStaticUtil = qjspp::bind::defineClass<void>("StaticUtil").members(StaticUtilMembers).build();
+
+TEST_CASE_METHOD(TestEngineFixture, "Compile-time Member Binding") {
+    qjspp::Locker scope{engine_};
+    engine_->registerClass(ScriptStaticVec3);
+    engine_->globalThis().set("assert", qjspp::Function{&JsAssert});
+
+    REQUIRE_NOTHROW(engine_->eval(R"(
+        var v = new StaticVec3(1, 2, 3);
+        assert(v.x === 1 && v.y === 2);
+        v.x = 5;
+        assert(v.toString() === 'Vec3(5,2,3)', v.toString());
+        assert(StaticVec3.baseTrue() === true);
+        assert(StaticVec3.baseName === 'Base');
+    )"));
+    REQUIRE(engine_->eval("try { v.toString(1); false } catch (e) { e instanceof TypeError }").asBoolean().value());
+
+    engine_->eval("StaticVec3.baseName = 'Changed'");
+    REQUIRE(Base::name == "Changed");
+    Base::name = "Base";
+
+    // 表项与回调均为常量
+    static_assert(StaticVec3Members.entries_.size() == 5);
+    static_assert(StaticVec3Members.entries_[0].name_ == "x");
+    static_assert(StaticVec3Members.entries_[2].kind_ == qjspp::bind::meta::MemberEntry::Kind::InstanceMethod);
+    static_assert(StaticUtilMembers.entries_[2].setter_ == nullptr); // const 变量只读
+
+    // 纯静态类
+    engine_->registerClass(ScriptStaticUtil);
+    REQUIRE(engine_->eval("StaticUtil.add(1, 2)").asNumber().getInt32() == 3);
+    REQUIRE(engine_->eval("StaticUtil.bar").asNumber().getInt32() == 666);
+    REQUIRE_NOTHROW(engine_->eval("StaticUtil.foo = 7"));
+    REQUIRE(Util::foo == 7);
+    REQUIRE(engine_->eval("try { StaticUtil.add(1); false } catch (e) { e instanceof TypeError }").asBoolean().value());
+    Util::foo = 42;
+}
+
+// 同一成员以两个属性 (不同类型定义) 暴露，偏移相同但缓存槽位不同
+auto ScriptAliasedAABB = qjspp::bind::defineClass<AABB>("AliasedAABB")
+                             .constructor<>()
+                             .instancePropertyRef("min", &AABB::min, ScriptVec3)
+                             .instancePropertyRef("staticMin", &AABB::min, ScriptStaticVec3)
+                             .build();
+
+TEST_CASE_METHOD(TestEngineFixture, "Member Wrapper Cache Slots") {
+    qjspp::Locker scope{engine_};
+    engine_->registerClass(ScriptVec3);
+    engine_->registerClass(ScriptStaticVec3);
+    engine_->registerClass(ScriptAliasedAABB);
+    engine_->globalThis().set("assert", qjspp::Function{&JsAssert});
+
+    REQUIRE_NOTHROW(engine_->eval(R"(
+        const box = new AliasedAABB();
+        const min = box.min;
+        const staticMin = box.staticMin;
+        assert(min instanceof Vec3 && staticMin instanceof StaticVec3);
+        assert(box.min === min && box.staticMin === staticMin);
+    )"));
+}
+
+TEST_CASE_METHOD(TestEngineFixture, "Lazy Class Registration") {
+    qjspp::Locker scope{engine_};
+    REQUIRE(engine_->registerClass(ScriptVec3, true));
+    REQUIRE(engine_->registerClass(ScriptAABB, true));
+    REQUIRE(engine_->registerClass(BaseDefine, true));
+    REQUIRE(engine_->registerClass(DerivedDefine, true));
+    REQUIRE_FALSE(engine_->registerClass(ScriptVec3, true));
+    engine_->globalThis().set("assert", qjspp::Function{&JsAssert});
+
+    // 构建前全局对象上仅有访问器
+    REQUIRE_NOTHROW(engine_->eval(R"(
+        let desc = Object.getOwnPropertyDescriptor(globalThis, 'AABB');
+        assert(typeof desc.get === 'function');
+        let box = new AABB();
+        desc = Object.getOwnPropertyDescriptor(globalThis, 'AABB');
+        assert(desc.value === AABB && desc.writable);
+        assert(box.min instanceof Vec3);
+    )"));
+
+    // C++ 创建实例时构建类，派生类构建时先构建基类
+    auto der = engine_->newInstanceOfRaw(DerivedDefine, new Derived{888});
+    engine_->globalThis().set("der", der);
+    REQUIRE(engine_->eval("der instanceof Derived && der instanceof Base").asBoolean().value());
+    REQUIRE(engine_->eval("der.baseMember + der.derivedMember").asNumber().getInt32() == 466 + 888);
+
+    // 构建前赋值直接覆盖全局属性
+    REQUIRE(engine_->registerClass(ScriptCachedVec3, true));
+    REQUIRE(engine_->eval("CachedVec3 = 1; CachedVec3").asNumber().getInt32() == 1);
+    auto cached = engine_->newInstanceOfRaw(ScriptCachedVec3, new Vec3{});
+    REQUIRE(engine_->isInstanceOf(cached, ScriptCachedVec3));
+    REQUIRE(engine_->eval("CachedVec3").asNumber().getInt32() == 1);
+
+    // 脚本保留的访问器在类构建后返回已有的构造函数，赋值被忽略
+    REQUIRE(engine_->registerClass(ScriptStaticVec3, true));
+    REQUIRE_NOTHROW(engine_->eval(R"(
+        const { get, set } = Object.getOwnPropertyDescriptor(globalThis, 'StaticVec3');
+        const ctor = StaticVec3;
+        assert(get() === ctor);
+        set(1);
+        assert(StaticVec3 === ctor && get() === ctor);
+        assert(new StaticVec3(1, 2, 3).x === 1);
+    )"));
+}
+
+class Tracked {
+public:
+    static inline std::atomic_int              destroyed{0};
+    static inline std::atomic<std::thread::id> lastThread{};
+
+    Tracked() = default;
+    ~Tracked() {
+        lastThread = std::this_thread::get_id();
+        ++destroyed;
+    }
+};
+
+auto ScriptTracked = qjspp::bind::defineClass<Tracked>("Tracked").constructor<>().build();
+
+auto ScriptBackgroundTracked =
+    qjspp::bind::defineClass<Tracked>("BackgroundTracked").constructor<>().threadSafeDestructible().build();
+
+TEST_CASE_METHOD(TestEngineFixture, "Deferred Finalization") {
+    qjspp::Locker scope{engine_};
+    engine_->registerClass(ScriptTracked);
+    engine_->registerClass(ScriptBackgroundTracked);
+
+    // 引用计数归零时 finalizer 在 eval 中运行，但只入队，Locker 释放前不析构
+    Tracked::destroyed = 0;
+    {
+        qjspp::Locker inner{engine_};
+        engine_->eval("for (let i = 0; i < 100; i++) new Tracked();");
+        REQUIRE(Tracked::destroyed == 0);
+    }
+    REQUIRE(Tracked::destroyed == 100);
+    REQUIRE(Tracked::lastThread.load() == std::this_thread::get_id());
+
+    // 循环引用只能由 GC 回收，原生析构在 GC 结束后批量执行
+    Tracked::destroyed = 0;
+    engine_->eval("for (let i = 0; i < 100; i++) { const o = { t: new Tracked() }; o.self = o; }");
+    REQUIRE(Tracked::destroyed == 0);
+    engine_->gc();
+    REQUIRE(Tracked::destroyed == 100);
+    REQUIRE(Tracked::lastThread.load() == std::this_thread::get_id());
+
+    // 积压达到 kBatchSize 后，长时间运行的脚本在中断轮询时分批析构，不等待 GC 或 Locker 释放
+    constexpr auto batch = qjspp::detail::FinalizeQueue::kBatchSize;
+    Tracked::destroyed   = 0;
+    engine_->globalThis().set("destroyedCount", qjspp::Function{[](qjspp::Arguments const&) -> qjspp::Value {
+                                  return qjspp::Number{Tracked::destroyed.load()};
+                              }});
+    auto count = engine_->eval(
+        "for (let i = 0; i < " + std::to_string(batch * 2) + "; i++) new Tracked();"
+        "for (let i = 0; i < 1000000; i++) {}" // 触发中断轮询
+        "destroyedCount();"
+    );
+    REQUIRE(count.asNumber().getInt32() >= static_cast<int>(batch));
+    engine_->gc();
+
+    // threadSafeDestructible 的类在后台线程析构
+    Tracked::destroyed = 0;
+    engine_->eval("for (let i = 0; i < 100; i++) new BackgroundTracked();");
+    engine_->gc();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (Tracked::destroyed < 100 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    REQUIRE(Tracked::destroyed == 100);
+    REQUIRE(Tracked::lastThread.load() != std::this_thread::get_id());
+}
+
+TEST_CASE_METHOD(TestEngineFixture, "Off-thread Release") {
+    qjspp::Locker scope{engine_};
+    engine_->registerClass(ScriptTracked);
+
+    Tracked::destroyed = 0;
+    std::optional<qjspp::ScopedJsValue>      held{std::in_place, engine_->eval("new Tracked()")};
+    std::optional<qjspp::JsCallback<void()>> callback{std::in_place, engine_->eval("(() => {})").asFunction()};
+
+    // 当前线程持有 Locker，其它线程释放句柄时不等待引擎锁，仅入队
+    std::thread{[&] {
+        held.reset();
+        callback.reset();
+    }}.join();
+    REQUIRE(Tracked::destroyed == 0);
+
+    // 下次获取 Locker 时释放
+    engine_->gc();
+    REQUIRE(Tracked::destroyed == 1);
+}
+
+class ReleaseOnDestroy {
+public:
+    static inline std::vector<qjspp::JsCallback<void()>>* callbacks{nullptr};
+
+    ReleaseOnDestroy() = default;
+    ~ReleaseOnDestroy() {
+        std::thread{[] { callbacks->clear(); }}.join();
+    }
+};
+
+auto ScriptReleaseOnDestroy = qjspp::bind::defineClass<ReleaseOnDestroy>("ReleaseOnDestroy").constructor<>().build();
+
+TEST_CASE_METHOD(TestEngineFixture, "Off-thread Release During Engine Destruction") {
+    std::vector<qjspp::JsCallback<void()>> callbacks;
+    ReleaseOnDestroy::callbacks = &callbacks;
+
+    auto engine = std::make_unique<qjspp::JsEngine>();
+    {
+        qjspp::Locker lock{*engine};
+        engine->registerClass(ScriptReleaseOnDestroy);
+        for (int i = 0; i < 16; ++i) {
+            callbacks.emplace_back(engine->eval("(() => {})").asFunction());
+        }
+        // 仅在析构时的 GC 中回收的环，实例析构时由其它线程释放回调
+        engine->eval("{ const cycle = { holder: new ReleaseOnDestroy() }; cycle.self = cycle; }");
+    }
+    engine.reset(); // 析构期间入队的值在运行时释放前清空，不泄漏也不访问已释放的任务队列
+    REQUIRE(callbacks.empty());
+    ReleaseOnDestroy::callbacks = nullptr;
+}
+
+#ifdef QJSPP_ENABLE_BINDING_PROFILER
+TEST_CASE_METHOD(TestEngineFixture, "Binding Profiler") {
+    qjspp::Locker scope{engine_};
+
+    engine_->registerClass(UtilDefine);
+    engine_->registerClass(ScriptVec3);
+
+    auto& profiler = engine_->getBindingProfiler();
+    profiler.reset();
+
+    engine_->eval("for (let i = 0; i < 10; i++) Util.add(i, i);");
+    engine_->eval("let v = new Vec3(1, 2, 3); v.x; v.x; v.x = 4; v.toString();");
+    REQUIRE_THROWS(engine_->eval("Util.add(1)")); // argument count mismatch
+
+    auto entries = profiler.snapshot(qjspp::BindingProfiler::SortBy::Calls);
+    REQUIRE(entries.front().name() == "Util.add");
+    REQUIRE(entries.front().calls_ == 11);
+    REQUIRE(entries.front().exceptions_ == 1);
+
+    auto getter = std::find_if(entries.begin(), entries.end(), [](auto const& e) {
+        return e.name() == "Vec3.x" && e.kind_ == qjspp::BindingKind::Getter;
+    });
+    REQUIRE(getter != entries.end());
+    REQUIRE(getter->calls_ == 2);
+
+    REQUIRE(profiler.dumpJson().front() == '[');
+    REQUIRE(profiler.dumpText().find("Util.add") != std::string::npos);
+
+    profiler.setSampleInterval(4);
+    profiler.reset();
+    engine_->eval("for (let i = 0; i < 8; i++) Util.add(i, i);");
+    entries = profiler.snapshot();
+    REQUIRE(entries.front().calls_ == 8);
+    REQUIRE(entries.front().sampledCalls_ == 2);
+}
+#endif
+
+auto ScriptOverloadRunner =
+    qjspp::bind::defineClass<void>("OverloadRunner")
+        .function(
+            "run",
+            [](qjspp::Function const& fn) -> qjspp::Value { return fn.call(); },
+            [](qjspp::Function const& fn, int) -> qjspp::Value { return fn.call(); }
+        )
+        .build();
+
+TEST_CASE_METHOD(TestEngineFixture, "Overload Keeps Termination Uncatchable") {
+    qjspp::Locker scope{engine_};
+    engine_->registerClass(ScriptOverloadRunner);
+
+    // 候选执行中被终止，不得转换为可捕获的 "no overload found"
+    engine_->setExecutionTimeout(std::chrono::milliseconds{50});
+    try {
+        engine_->eval("try { OverloadRunner.run(() => { while (true) {} }) } catch (e) {} globalThis.caught = true;");
+        FAIL("script was not terminated");
+    } catch (qjspp::JsException const& e) {
+        REQUIRE(e.type() == qjspp::JsException::Type::Terminated);
+    }
+    REQUIRE_FALSE(engine_->globalThis().has("caught"));
+
+    engine_->setExecutionTimeout(std::chrono::milliseconds{0});
+    REQUIRE(engine_->eval("OverloadRunner.run(() => 1, 0)").asNumber().getInt32() == 1);
+}
+
+int OverloadCalls = 0;
+
+auto ScriptOverloadErrors = qjspp::bind::defineClass<void>("OverloadErrors")
+                                .function(
+                                    "run",
+                                    [](qjspp::Function const& fn) -> qjspp::Value {
+                                        ++OverloadCalls;
+                                        return fn.call();
+                                    },
+                                    [](qjspp::Value const&) -> qjspp::Value {
+                                        ++OverloadCalls;
+                                        return qjspp::String{"fallback"};
+                                    }
+                                )
+                                .build();
+
+TEST_CASE_METHOD(TestEngineFixture, "Overload Propagates Candidate Errors") {
+    qjspp::Locker scope{engine_};
+    engine_->registerClass(ScriptOverloadErrors);
+
+    // 选定的候选抛出的异常原样传播，不会回退到同样能接受该参数的后续候选
+    OverloadCalls = 0;
+    REQUIRE(engine_->eval(R"(
+        try { OverloadErrors.run(() => { throw new RangeError('boom'); }); false }
+        catch (e) { e instanceof RangeError && e.message === 'boom' }
+    )")
+                .asBoolean()
+                .value());
+    REQUIRE(OverloadCalls == 1);
+
+    // 探测不匹配时才尝试下一个候选
+    OverloadCalls = 0;
+    REQUIRE(engine_->eval("OverloadErrors.run(1)").asString().value() == "fallback");
+    REQUIRE(OverloadCalls == 1);
 }
\ No newline at end of file
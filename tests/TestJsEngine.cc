@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <thread>
 
 
 TEST_CASE_METHOD(TestEngineFixture, "Test JsEngine") {
@@ -45,6 +46,55 @@ TEST_CASE_METHOD(TestEngineFixture, "Test JsEngine") {
         }
     }
 
+    SECTION("Test JsException::errorInfo") {
+        qjspp::JsException::ErrorInfo info;
+        try {
+            engine_->eval(
+                "function foo() {\n"
+                "    throw new TypeError('bad value');\n"
+                "}\n"
+                "foo();\n",
+                "error.js"
+            );
+        } catch (qjspp::JsException const& e) {
+            info = e.errorInfo();
+            REQUIRE(e.message() == "bad value");
+        }
+        REQUIRE(info.name_ == "TypeError");
+        REQUIRE(info.message_ == "bad value");
+        REQUIRE(!info.frames_.empty());
+        REQUIRE(info.frames_.front().functionName_ == "foo");
+        REQUIRE(info.frames_.front().url_ == "error.js");
+        REQUIRE(info.frames_.front().line_ == 2);
+
+        // 快照不依赖引擎，可在其他线程读取
+        std::string name;
+        std::thread{[&name, copy = info] { name = copy.name_ + ": " + copy.message_; }}.join();
+        REQUIRE(name == "TypeError: bad value");
+
+        auto native = qjspp::JsException{qjspp::JsException::Type::RangeError, "out of range"};
+        REQUIRE(native.errorInfo().name_ == "RangeError");
+        REQUIRE(native.errorInfo().frames_.empty());
+
+        // 先读取快照再创建异常对象，快照随之刷新为带调用栈的版本
+        auto refresh = qjspp::Function{[](qjspp::Arguments const&) -> qjspp::Value {
+            auto        e    = qjspp::JsException{qjspp::JsException::Type::RangeError, "late"};
+            auto const& info = e.errorInfo();
+            REQUIRE(info.stack_.empty());
+            (void)e.exception();
+            REQUIRE(&e.errorInfo() == &info);
+            REQUIRE(info.name_ == "RangeError");
+            REQUIRE(info.message_ == "late");
+            REQUIRE(!info.stack_.empty());
+            REQUIRE(std::any_of(info.frames_.begin(), info.frames_.end(), [](auto const& frame) {
+                return frame.functionName_ == "callRefresh";
+            }));
+            return {};
+        }};
+        engine_->globalThis().set(qjspp::String{"refresh"}, refresh);
+        engine_->eval("function callRefresh() { refresh(); }\ncallRefresh();\n", "refresh.js");
+    }
+
     SECTION("Test JsEngine::loadScript") {
         auto test = qjspp::Function{[](qjspp::Arguments const& args) -> qjspp::Value {
             REQUIRE(args.length() == 1);
@@ -95,3 +145,156 @@ TEST_CASE_METHOD(TestEngineFixture, "Test JsEngine") {
         REQUIRE(done == true);
     }
 }
+
+TEST_CASE_METHOD(TestEngineFixture, "Test Idle GC") {
+    qjspp::Locker scope(engine_);
+
+    SECTION("TaskQueue idle handler") {
+        int              idle = 0;
+        qjspp::TaskQueue queue;
+        queue.setIdleHandler([](void* data) { ++*static_cast<int*>(data); }, &idle);
+
+        queue.postTask([](void*) {});
+        REQUIRE(queue.loopOnce() == true); // task executed, not idle
+        REQUIRE(idle == 0);
+
+        REQUIRE(queue.loopOnce() == false);
+        REQUIRE(idle == 1);
+    }
+
+    SECTION("JsEngine::idleGc") {
+        REQUIRE(engine_->idleGc() == false); // not enabled
+
+        engine_->enableIdleGc({.allocationThreshold = 0, .checkIntervalMs = 0});
+        REQUIRE(engine_->idleGc() == true);
+
+        {
+            qjspp::JsEngine::LatencyCriticalScope critical{engine_};
+            REQUIRE(engine_->idleGc() == false);
+        }
+        REQUIRE(engine_->idleGc() == true);
+
+        engine_->disableIdleGc();
+        REQUIRE(engine_->idleGc() == false);
+    }
+
+    SECTION("JsEngine::idleGc threshold") {
+        engine_->enableIdleGc({.allocationThreshold = 1024 * 1024, .checkIntervalMs = 0, .disableAutoGc = true});
+        REQUIRE(engine_->idleGc() == false);
+
+        engine_->eval("globalThis.garbage = []; for (let i = 0; i < 100000; i++) garbage.push({ i });");
+        REQUIRE(engine_->idleGc() == true);
+    }
+}
+
+
+TEST_CASE_METHOD(TestEngineFixture, "Test CpuProfiler") {
+    qjspp::Locker scope(engine_);
+
+    engine_->globalThis().set(
+        "callJs",
+        qjspp::Function{
+            [](qjspp::Arguments const& args) -> qjspp::Value { return args[0].asFunction().call(); },
+            "callJs"
+        }
+    );
+
+    auto& profiler = engine_->getCpuProfiler();
+    profiler.start({.interval = std::chrono::microseconds{200}});
+    REQUIRE(profiler.isRunning());
+
+    engine_->eval(
+        R"(
+            function hot() {
+                const begin = Date.now();
+                let n = 0;
+                while (Date.now() - begin < 50) n++;
+                return n;
+            }
+            callJs(hot);
+        )",
+        "profile.js"
+    );
+    profiler.stop();
+    REQUIRE_FALSE(profiler.isRunning());
+    REQUIRE(profiler.sampleCount() > 0);
+
+    auto const& nodes = profiler.nodes();
+    auto        hot   = std::find_if(nodes.begin(), nodes.end(), [](auto const& n) {
+        return n.frame_.functionName_ == "hot";
+    });
+    REQUIRE(hot != nodes.end());
+    REQUIRE(hot->frame_.url_ == "profile.js");
+    REQUIRE(hot->frame_.line_ > 0);
+
+    // hot 由原生函数 callJs 调用
+    auto const& parent = nodes[hot->parent_ - 1];
+    REQUIRE(parent.frame_.native_);
+    REQUIRE(parent.frame_.functionName_ == "callJs");
+
+    auto profile = profiler.toCpuProfile();
+    REQUIRE(profile.find("\"samples\":[") != std::string::npos);
+    REQUIRE(profile.find("\"functionName\":\"hot\"") != std::string::npos);
+
+    auto trace = profiler.toTraceEvents();
+    REQUIRE(trace.find("\"name\":\"callJs\",\"cat\":\"native\"") != std::string::npos);
+
+    profiler.reset();
+    REQUIRE(profiler.sampleCount() == 0);
+    REQUIRE(profiler.nodes().size() == 1);
+}
+
+
+TEST_CASE_METHOD(TestEngineFixture, "Test Execution Limits") {
+    qjspp::Locker scope(engine_);
+
+    auto requireTerminated = [&](std::string const& code, std::string_view message) {
+        try {
+            engine_->eval(code);
+            FAIL("script was not terminated");
+        } catch (qjspp::JsException const& e) {
+            REQUIRE(e.type() == qjspp::JsException::Type::Terminated);
+            REQUIRE(e.message() == message);
+        }
+        REQUIRE(engine_->eval("1 + 1").asNumber().getInt32() == 2); // engine still usable
+    };
+
+    SECTION("execution timeout") {
+        engine_->setExecutionTimeout(std::chrono::milliseconds{50});
+        requireTerminated("while (true) {}", "execution deadline exceeded");
+
+        // JS 侧无法捕获
+        requireTerminated(
+            "try { while (true) {} } catch (e) {} globalThis.caught = true;",
+            "execution deadline exceeded"
+        );
+        REQUIRE_FALSE(engine_->globalThis().has("caught"));
+
+        // 经过原生帧继续向外传播
+        engine_->globalThis().set("callJs", qjspp::Function{[](qjspp::Arguments const& args) -> qjspp::Value {
+                                      return args[0].asFunction().call();
+                                  }});
+        requireTerminated("callJs(() => { while (true) {} })", "execution deadline exceeded");
+
+        engine_->setExecutionTimeout(std::chrono::milliseconds{0});
+        REQUIRE_NOTHROW(engine_->eval("for (let i = 0; i < 100000; i++) {}"));
+    }
+
+    SECTION("terminate from another thread") {
+        std::thread watchdog{[engine = engine_]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds{50});
+            engine->terminate();
+        }};
+        requireTerminated("while (true) {}", "execution terminated");
+        watchdog.join();
+    }
+
+    SECTION("DeadlineScope") {
+        auto loop = engine_->eval("(function() { while (true) {} })").asFunction();
+        {
+            qjspp::JsEngine::DeadlineScope deadline{engine_, std::chrono::milliseconds{50}};
+            REQUIRE_THROWS_AS(loop.call(), qjspp::JsException);
+        }
+        REQUIRE(engine_->eval("1 + 1").asNumber().getInt32() == 2);
+    }
+}
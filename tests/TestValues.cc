@@ -3,6 +3,7 @@
 #include "catch2/matchers/catch_matchers.hpp"
 #include "catch2/matchers/catch_matchers_exception.hpp"
 #include "qjspp/Forward.hpp"
+#include "qjspp/bind/TypeConverter.hpp"
 #include "qjspp/runtime/JsEngine.hpp"
 #include "qjspp/runtime/JsException.hpp"
 #include "qjspp/runtime/Locker.hpp"
@@ -16,11 +17,20 @@
 #include "qjspp/types/String.hpp"
 #include "qjspp/types/Undefined.hpp"
 #include "qjspp/types/Value.hpp"
+#include "qjspp/types/ValueRef.hpp"
 
 
 #include <algorithm>
 #include <cstdint>
 #include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+#include <vector>
 
 
 qjspp::Value sub(qjspp::Arguments const& args) {
@@ -33,6 +43,20 @@ int         add(int a, int b) { return a + b; }
 std::string append(std::string const& a, std::string const& b) { return a + b; }
 std::string append(std::string const& a, int b) { return a + std::to_string(b); }
 
+struct Point {
+    int x{0};
+    int y{0};
+};
+QJSPP_STRUCT(Point, x, y);
+
+struct Segment {
+    Point                      from;
+    Point                      to;
+    std::string                label;
+    std::optional<std::string> note;
+};
+QJSPP_STRUCT(Segment, from, to, label, note);
+
 
 TEST_CASE_METHOD(TestEngineFixture, "Values") {
     qjspp::Locker scope(engine_);
@@ -177,6 +201,17 @@ TEST_CASE_METHOD(TestEngineFixture, "Values") {
         // engine_->globalThis().set("append", append);
 
         REQUIRE(engine_->eval("sub(1, 2)").asNumber().getInt32() == -1);
+
+        // invoke: C++ 参数直接转换，返回值按需转换
+        auto add = engine_->eval("(function(a, b) { return a + b; })").asFunction();
+        REQUIRE(add.invoke<int>(1, 2) == 3);
+        REQUIRE(add.invoke<std::string>(std::string{"a"}, std::string{"b"}) == "ab");
+        REQUIRE(add.invoke(1, 2).isNumber());
+        REQUIRE_NOTHROW(add.invoke<void>());
+
+        auto getX = engine_->eval("(function(y) { return this.x + y; })").asFunction();
+        auto thiz = engine_->eval("({ x: 40 })");
+        REQUIRE(getX.invokeWithThis<int>(thiz, 2) == 42);
         // REQUIRE(engine_->eval("add(1, 2)").asNumber().getInt32() == 3);
         // REQUIRE(engine_->eval("append('hello', 'world')").asString().value() == "helloworld");
         // REQUIRE(engine_->eval("append('hello', 123)").asString().value() == "hello123");
@@ -202,6 +237,133 @@ TEST_CASE_METHOD(TestEngineFixture, "Values") {
         );
     }
 
+    SECTION("Test ValueRef") {
+        engine_->globalThis().set(
+            "borrow", //
+            qjspp::Function{[](qjspp::Arguments const& arguments) -> qjspp::Value {
+                REQUIRE(arguments.at(0)->isNumber());
+                REQUIRE(arguments.at(1)->isObject());
+                REQUIRE(arguments.at(2)->isUndefined()); // out of range
+
+                auto                ref  = arguments.at(0);
+                qjspp::Value const& view = ref;
+                REQUIRE(view.asNumber().getInt32() == 42);
+
+                // 复制与赋值借用不影响被引用值的引用计数
+                for (int i = 0; i < 100; ++i) {
+                    auto copy = arguments.at(1);
+                    ref       = copy;
+                }
+                REQUIRE(ref.value() == arguments.at(1).value());
+                REQUIRE(ref->asObject().get("a").asNumber().getInt32() == 1);
+
+                auto owned = arguments.at(1).toValue();
+                return owned; // 借用值转为持有后可以返回
+            }}
+        );
+        auto ret = engine_->eval("const o = { a: 1 }; borrow(42, o) === o");
+        REQUIRE(ret.asBoolean().value());
+    }
+
+    SECTION("Test Container Converters") {
+        using qjspp::bind::ConvertToCpp;
+        using qjspp::bind::ConvertToJs;
+
+        auto object = engine_->eval(R"(
+            const o = { b: 2, a: 1, c: 3 };
+            Object.defineProperty(o, "hidden", { value: 4, enumerable: false });
+            o
+        )");
+
+        size_t reserved = 0;
+        size_t visited  = 0;
+        object.asObject().forEachOwnProperty(
+            [&](std::string_view key, qjspp::Value const& value) {
+                REQUIRE(key != "hidden"); // 仅可枚举属性
+                REQUIRE(value.isNumber());
+                ++visited;
+            },
+            [&](size_t count) { reserved = count; }
+        );
+        REQUIRE(reserved == 3);
+        REQUIRE(visited == 3);
+
+        auto unordered = ConvertToCpp<std::unordered_map<std::string, int>>(object);
+        REQUIRE(unordered.size() == 3);
+        REQUIRE(unordered.at("c") == 3);
+
+        auto ordered = ConvertToCpp<std::map<std::string, int>>(object);
+        REQUIRE(ordered.size() == 3);
+        REQUIRE(ordered.begin()->first == "a");
+        REQUIRE(ConvertToCpp<std::map<std::string, int>>(ConvertToJs(ordered)) == ordered);
+
+        auto set = ConvertToCpp<std::unordered_set<int>>(engine_->eval("[1, 2, 2, 3]"));
+        REQUIRE(set == std::unordered_set<int>{1, 2, 3});
+        REQUIRE(ConvertToJs(set).asArray().length() == 3);
+    }
+
+    SECTION("Test CanConvert") {
+        using qjspp::bind::CanConvertToCpp;
+        using qjspp::bind::ConvertToCpp;
+
+        qjspp::Value number = qjspp::Number{1};
+        qjspp::Value null   = qjspp::Null{};
+        qjspp::Value array  = engine_->eval("[1, 2]");
+        REQUIRE(CanConvertToCpp<int>(number));
+        REQUIRE(CanConvertToCpp<int const&>(number));
+        REQUIRE_FALSE(CanConvertToCpp<std::string>(number));
+        REQUIRE(CanConvertToCpp<std::optional<int>>(null));
+        REQUIRE_FALSE(CanConvertToCpp<int>(null));
+
+        // 最后一个候选匹配时，前面的候选经 canConvert 跳过
+        using Variant = std::variant<int, std::string, std::vector<int>>;
+        REQUIRE(CanConvertToCpp<Variant>(array));
+        REQUIRE_FALSE(CanConvertToCpp<Variant>(null));
+        REQUIRE(std::get<std::vector<int>>(ConvertToCpp<Variant>(array)).size() == 2);
+    }
+
+    SECTION("Test Number Converters") {
+        using qjspp::bind::ConvertToCpp;
+        using qjspp::bind::ConvertToJs;
+
+        // 整数在 int32 范围内以 JS_TAG_INT 创建
+        REQUIRE(JS_VALUE_GET_TAG(qjspp::Value::extract(ConvertToJs(42))) == JS_TAG_INT);
+        REQUIRE(JS_VALUE_GET_TAG(qjspp::Value::extract(ConvertToJs(uint16_t{7}))) == JS_TAG_INT);
+        REQUIRE(JS_VALUE_GET_TAG(qjspp::Value::extract(ConvertToJs(3000000000u))) == JS_TAG_FLOAT64);
+        REQUIRE(ConvertToCpp<uint32_t>(ConvertToJs(3000000000u)) == 3000000000u);
+
+        REQUIRE(ConvertToCpp<int>(engine_->eval("-7")) == -7);
+        REQUIRE(ConvertToCpp<int>(engine_->eval("2.9")) == 2); // 截断
+        REQUIRE(ConvertToCpp<uint8_t>(engine_->eval("255")) == 255);
+        REQUIRE(ConvertToCpp<double>(engine_->eval("3")) == 3.0);
+        REQUIRE(ConvertToCpp<float>(engine_->eval("0.5")) == 0.5f);
+
+        // 超出目标类型范围时抛出 RangeError
+        REQUIRE_THROWS_AS(ConvertToCpp<uint8_t>(engine_->eval("256")), qjspp::JsException);
+        REQUIRE_THROWS_AS(ConvertToCpp<uint32_t>(engine_->eval("-1")), qjspp::JsException);
+        REQUIRE_THROWS_AS(ConvertToCpp<int>(engine_->eval("2 ** 31")), qjspp::JsException);
+        REQUIRE_THROWS_AS(ConvertToCpp<int>(engine_->eval("NaN")), qjspp::JsException);
+    }
+
+    SECTION("Test Struct Converter") {
+        using qjspp::bind::ConvertToCpp;
+        using qjspp::bind::ConvertToJs;
+
+        auto js = ConvertToJs(Segment{{1, 2}, {3, 4}, "seg", std::nullopt});
+        engine_->globalThis().set("seg", js);
+        REQUIRE(engine_->eval("JSON.stringify(seg)").asString().value()
+                == R"({"from":{"x":1,"y":2},"to":{"x":3,"y":4},"label":"seg","note":null})");
+
+        auto seg = ConvertToCpp<Segment>(engine_->eval("({ from: { x: 5, y: 6 }, to: { x: 7, y: 8 }, label: 'l' })"));
+        REQUIRE(seg.from.x == 5);
+        REQUIRE(seg.to.y == 8);
+        REQUIRE(seg.label == "l");
+        REQUIRE_FALSE(seg.note.has_value());
+
+        REQUIRE_THROWS_AS(ConvertToCpp<Point>(engine_->eval("42")), qjspp::JsException);
+        REQUIRE_THROWS_AS(ConvertToCpp<Point>(engine_->eval("({ x: 1 })")), qjspp::JsException); // y 缺失
+    }
+
     SECTION("Test ConstructorFunction") {
         engine_->globalThis().set(
             "reg", //
@@ -22,6 +22,16 @@ option("test")
     set_showmenu(true)
 option_end()
 
+option("binding_profiler")
+    set_default(false)
+    set_showmenu(true)
+option_end()
+
+option("bench")
+    set_default(false)
+    set_showmenu(true)
+option_end()
+
 -- set_toolchains("clang-cl")
 
 target("qjspp")
@@ -43,6 +53,10 @@ target("qjspp")
         add_defines("QJSPP_DEBUG")
     end
 
+    if has_config("binding_profiler") then
+        add_defines("QJSPP_ENABLE_BINDING_PROFILER", {public = true})
+    end
+
     if has_config("test") then
         set_kind("binary")
         add_files("tests/**.cc")
@@ -66,3 +80,24 @@ target("qjspp")
         os.cp(test, binDir)
     end)
 target_end()
+
+-- 微基准测试: xmake f -m release --bench=y && xmake build bench && xmake run bench --json
+-- 依赖 qjspp 静态库，不能与 --test 同时启用
+if has_config("bench") then
+    target("bench")
+        set_kind("binary")
+        set_default(false)
+        add_deps("qjspp")
+        add_files("bench/**.cc")
+        add_includedirs("include")
+        set_languages("cxx20")
+        add_packages("quickjs-ng")
+
+        if is_plat("windows") then
+            add_cxflags("/utf-8", "/W4")
+        elseif is_plat("linux") then
+            add_cxflags("-stdlib=libc++", {force = true})
+            add_syslinks("dl", "pthread")
+        end
+    target_end()
+end